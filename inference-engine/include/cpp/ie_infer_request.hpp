@@ -12,7 +12,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "cpp/ie_memory_state.hpp"
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
 #include "details/ie_so_loader.h"
@@ -206,6 +208,31 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+     * @copybrief IInferRequest::QueryState
+     *
+     * Wraps IInferRequest::QueryState
+     * @return A vector of Memory State objects
+     */
+    std::vector<MemoryState> QueryState() {
+        if (actual == nullptr) THROW_IE_EXCEPTION << "InferRequest was not initialized.";
+        IMemoryState::Ptr pState = nullptr;
+        auto res = OK;
+        std::vector<MemoryState> controller;
+        for (size_t idx = 0; res == OK; ++idx) {
+            ResponseDesc resp;
+            res = actual->QueryState(pState, idx, &resp);
+            if (res != OK && res != OUT_OF_BOUNDS) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+            if (res != OUT_OF_BOUNDS) {
+                controller.push_back(MemoryState(pState));
+            }
+        }
+
+        return controller;
+    }
+
     /**
      * @brief Start inference of specified input(s) in asynchronous mode
      *
@@ -35,5 +35,47 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of pipelined execution of the subgraphs.
+ * Every subgraph has a couple of infer requests shared by all the infer requests of the executable network,
+ * so while a subgraph processes an infer request the previous subgraph already processes the next one.
+ * This option should be used with values: CONFIG_VALUE(NO) (default) or CONFIG_VALUE(YES)
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINED_EXECUTION);
+
+/**
+ * @brief The key for the policy of assigning the layers to the devices when the network has no affinities.
+ * HETERO_FIRST_SUPPORTED (default) - a layer is assigned to the first device in TARGET_FALLBACK which supports it
+ * HETERO_MIN_LATENCY - the network is cut to the contiguous segments of the topological order which minimize
+ * the estimated latency: the layer costs, the costs of the tensors transferred between the devices and
+ * the costs of the subgraphs
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(FIRST_SUPPORTED);
+DECLARE_HETERO_CONFIG_VALUE(MIN_LATENCY);
+
+/**
+ * @brief The key for the path to the table of the layer costs used by HETERO_MIN_LATENCY policy.
+ * Every line of the file is `<device> <layer name or layer type> <microseconds>`, lines starting with `#`
+ * are skipped. The costs can be taken from the performance counters of the devices.
+ * The cost of a layer missing in the table is estimated from the size of its outputs
+ */
+DECLARE_HETERO_CONFIG_KEY(COST_TABLE);
+
+/**
+ * @brief The key for the cost in microseconds of a megabyte transferred between the devices, "100" by default
+ */
+DECLARE_HETERO_CONFIG_KEY(TRANSFER_COST);
+
+/**
+ * @brief The key for the fixed cost in microseconds of the execution of a subgraph, "50" by default
+ */
+DECLARE_HETERO_CONFIG_KEY(SUBGRAPH_COST);
+
+/**
+ * @brief The key for the maximal number of subgraphs created by HETERO_MIN_LATENCY policy, "0" means no limit
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -80,6 +80,8 @@ public:
      * @param weights shared pointer to constant blob with weights
      * ONNX models doesn't support models with data blobs.
      * For ONNX case the second parameter should contain empty blob.
+     * @note For IR the network may refer to the weights blob memory without copying it,
+     * so the blob memory must stay valid and unchanged while the network is used.
      * @return CNNNetwork
      */
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const;
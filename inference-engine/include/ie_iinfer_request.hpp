@@ -16,6 +16,7 @@
 
 #include "ie_blob.h"
 #include "ie_common.h"
+#include "ie_imemory_state.hpp"
 #include "ie_preprocess.hpp"
 #include "details/ie_irelease.hpp"
 
@@ -177,6 +178,21 @@ public:
      * @return Enumeration of the resulted action: InferenceEngine::OK (0) for success
      */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc* resp) noexcept = 0;
+
+    /**
+     * @brief Gets state control interface for the request.
+     *
+     * The states returned by the request belong to this request only, so several requests of one executable network
+     * run independent streaming sessions. A plugin which keeps the states per executable network (see
+     * IExecutableNetwork::QueryState) reports no states here.
+     *
+     * @param pState reference to a pointer that receives internal states
+     * @param idx requested index for receiving memory state
+     * @param resp Optional: pointer to an already allocated object to contain information in case of failure
+     * @return Status code of the operation: InferenceEngine::OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for
+     * given index
+     */
+    virtual StatusCode QueryState(IMemoryState::Ptr& pState, size_t idx, ResponseDesc* resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
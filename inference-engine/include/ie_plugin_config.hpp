@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -156,6 +158,92 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get the size in bytes of memory planned for intermediate tensors of one inference stream.
+ * String value is "ACTIVATIONS_MEMORY_SIZE".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get the lower bound in bytes of memory for intermediate tensors of one inference stream:
+ * the maximal total size of tensors alive at the same time. String value is "ACTIVATIONS_MEMORY_LOWER_BOUND".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_LOWER_BOUND, uint64_t);
+
+/**
+ * @brief Metric to get the number of original elementwise layers which are executed by fused elementwise kernels.
+ * String value is "COLLAPSED_ELTWISE_LAYERS".
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(COLLAPSED_ELTWISE_LAYERS, unsigned int);
+
+/**
+ * @brief Metric to get a bool value which shows whether executable networks of a device can be exported and imported back.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT". Devices which report `true` are used with Core compiled network cache.
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get a number of Core::LoadNetwork calls served from the in-memory executable network cache
+ * of a device (see NETWORK_CACHE_SIZE config key). String value is "NETWORK_CACHE_HITS".
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get a number of Core::LoadNetwork calls which compiled a network because the in-memory executable
+ * network cache of a device did not contain it. String value is "NETWORK_CACHE_MISSES".
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get a float of total time in milliseconds spent on compilation of networks missed in the in-memory
+ * executable network cache of a device. String value is "NETWORK_CACHE_COMPILE_TIME".
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_COMPILE_TIME, float);
+
+/**
+ * @brief Metric to get a number of JIT kernels a device reused from its process wide kernel cache instead of
+ * generating them again for a node of a loaded network. String value is "KERNEL_CACHE_HITS".
+ */
+DECLARE_METRIC_KEY(KERNEL_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get a number of JIT kernels a device generated because its process wide kernel cache did not
+ * contain them. String value is "KERNEL_CACHE_MISSES".
+ */
+DECLARE_METRIC_KEY(KERNEL_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get the hardware events of the executed layers collected with CPU_HW_PERF_COUNTERS config key.
+ *
+ * String value is "HW_PERF_COUNTERS". The value maps a layer name to the totals over all executions of the layer
+ * in all streams: EXECUTIONS, REAL_TIME_NS, CPU_CYCLES, INSTRUCTIONS, LLC_REFERENCES and LLC_MISSES.
+ * The map is empty if the counters are disabled or not permitted by the operating system.
+ * Instructions per cycle tell compute-bound layers, LLC misses multiplied by the cache line size and divided by
+ * the time estimate the memory bandwidth of a layer.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HW_PERF_COUNTERS, std::map<std::string, std::map<std::string, uint64_t>>);
+
+DECLARE_METRIC_VALUE(EXECUTIONS);
+DECLARE_METRIC_VALUE(REAL_TIME_NS);
+DECLARE_METRIC_VALUE(CPU_CYCLES);
+DECLARE_METRIC_VALUE(INSTRUCTIONS);
+DECLARE_METRIC_VALUE(LLC_REFERENCES);
+DECLARE_METRIC_VALUE(LLC_MISSES);
+
+/**
+ * @brief Metric to get the timing of the parallel branches execution enabled with CPU_PARALLEL_BRANCHES config key.
+ *
+ * String value is "WAVEFRONT_EXECUTION". The value has the totals over all inferences in all streams: WAVES (the
+ * number of waves of the graph), EXECUTIONS, REAL_TIME_NS (the time of the graph execution) and NODES_TIME_NS
+ * (the sum of the times of the executed layers). NODES_TIME_NS divided by REAL_TIME_NS is the achieved concurrency.
+ * The timing is collected only with PERF_COUNT config key enabled, the map is empty otherwise.
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(WAVEFRONT_EXECUTION, std::map<std::string, uint64_t>);
+
+DECLARE_METRIC_VALUE(WAVES);
+DECLARE_METRIC_VALUE(NODES_TIME_NS);
+
 }  // namespace Metrics
 
 /**
@@ -212,6 +300,9 @@ DECLARE_CONFIG_VALUE(NUMA);
  *   this is the most portable option if you have no insights into how many cores you target machine will have
  *   (and what is the optimal number of streams)
  * - finally, specifying the positive integer value creates the requested number of streams
+ *
+ * The streams of one executable network share its weights and constant data. Executable networks
+ * loaded separately from the same model keep their own copies.
  */
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
@@ -360,5 +451,88 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief The name for setting to execute independent branches of a network in parallel (CPU only)
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * In this mode the nodes of a network graph are grouped into waves: all nodes of a wave have their
+ * inputs computed and are executed concurrently within the threads of the inference stream.
+ * This improves the utilization of the cores for networks with many small independent branches
+ * (Inception-like topologies, multi-head networks).
+ * With PERF_COUNT enabled the achieved concurrency is reported by the WAVEFRONT_EXECUTION metric of the
+ * executable network.
+ */
+DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief The name for setting to count hardware events of every executed layer (CPU only)
+ *
+ * It is passed to Core::SetConfig() or Core::LoadNetwork(), this option should be used with values:
+ * PluginConfigParams::YES or PluginConfigParams::NO (default).
+ * The user space CPU cycles, instructions, last level cache references and misses of all threads of an inference
+ * stream are read with Linux perf_event_open before and after every layer and reported by the HW_PERF_COUNTERS
+ * metric of the executable network. Independent branches are not executed in parallel in this mode
+ * (see CPU_PARALLEL_BRANCHES) to attribute the events to the layers, and every stream executes its layers in
+ * its own thread arena, so the threads are counted only while they work for that stream. The counters are not
+ * available on other operating systems or if /proc/sys/kernel/perf_event_paranoid is greater than 2.
+ */
+DECLARE_CONFIG_KEY(CPU_HW_PERF_COUNTERS);
+
+/**
+ * @brief This key defines the directory which is used by Core to cache compiled networks.
+ *
+ * If a device supports import / export of executable networks (see IMPORT_EXPORT_SUPPORT metric),
+ * Core::LoadNetwork stores an exported network in this directory and imports it on the next call
+ * for the same network, device, configuration and device capabilities instead of compiling it again.
+ * Cached networks are device specific and are not reused after the device plugin is updated.
+ * If the key is not set or the value is an empty string, caching is disabled.
+ * The key is handled by Core itself and is not passed to plugins:
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}});        // enables cache for all devices
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}}, "CPU"); // enables cache for CPU device only
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
+/**
+ * @brief This key defines the maximal number of executable networks Core keeps in memory for a device.
+ *
+ * Core::LoadNetwork returns a cached executable network if it is called again for the same nGraph function with
+ * the same input and output shapes, precisions and layouts and the same configuration, so reshape-heavy
+ * applications do not compile a network for every shape they have already seen. The least recently used network
+ * is dropped when the cache is full. The cache is cleared when the configuration of any device is changed with
+ * Core::SetConfig. The default value is "0" and disables the cache.
+ * The key is handled by Core itself and can be passed to Core::SetConfig or Core::LoadNetwork:
+ * ie.SetConfig({{CONFIG_KEY(NETWORK_CACHE_SIZE), "8"}}, "CPU");
+ * Cache efficiency is reported by NETWORK_CACHE_HITS, NETWORK_CACHE_MISSES and NETWORK_CACHE_COMPILE_TIME metrics.
+ */
+DECLARE_CONFIG_KEY(NETWORK_CACHE_SIZE);
+
+/**
+ * @brief This key defines sizes the input dimensions are padded up to before a network is compiled.
+ *
+ * The value is a semicolon separated list of "<input name>:<axis>:<size>,<size>,..." entries. A dimension is
+ * replaced by the smallest size which is not less than the dimension, dimensions larger than all sizes are not
+ * changed. Networks with padded shapes are compiled and cached (see NETWORK_CACHE_SIZE) instead of the original ones,
+ * so a few compiled networks serve many shapes. The returned executable network reports the padded input shapes,
+ * and an application must pad its input data accordingly. Only nGraph based networks are padded.
+ * The key is handled by Core itself and can be passed to Core::SetConfig or Core::LoadNetwork:
+ * ie.SetConfig({{CONFIG_KEY(SHAPE_BUCKETS), "data:3:64,128,256,512"}}, "CPU");
+ */
+DECLARE_CONFIG_KEY(SHAPE_BUCKETS);
+
+/**
+ * @brief This key defines a file the built-in tracer writes the timeline of inference requests to.
+ *
+ * Setting a non-empty value starts tracing for the whole process: the waits in the executor queues, preprocessing,
+ * the execution of the network layers, the completion callbacks and the lifetime of every request are recorded.
+ * Every thread keeps only its latest events in a ring buffer. Setting an empty value stops tracing and writes the
+ * events to the file in Chrome trace_event JSON format, which can be opened with chrome://tracing or
+ * https://ui.perfetto.dev. The file is also written when the Core is destroyed.
+ * The key is handled by Core itself, does not depend on a device and can be passed to Core::SetConfig only:
+ * ie.SetConfig({{CONFIG_KEY(TRACE_FILE), "trace.json"}});  // starts tracing
+ * ie.SetConfig({{CONFIG_KEY(TRACE_FILE), ""}});            // stops tracing and writes trace.json
+ */
+DECLARE_CONFIG_KEY(TRACE_FILE);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -26,6 +29,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +43,37 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The policy of choosing the device for an inference request
+ * MULTI_PRIORITY - the first device with an idle request is taken in the priorities order (default)
+ * MULTI_EARLIEST_COMPLETION - the device which is expected to complete the request first according to
+ * the measured latencies of the devices, the request waits for a busy device if it is expected to be faster
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(EARLIEST_COMPLETION);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get the number of inference requests executed by every device of the MULTI executable network
+ * at the moment
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_QUEUE_DEPTH, std::map<std::string, unsigned int>);
+
+/**
+ * @brief Metric to get the utilization of every device of the MULTI executable network: the fraction of the time
+ * since the network is loaded which the device infer requests were busy, in [0, 1]
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_UTILIZATION, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get the rolling average latency in milliseconds of an inference on every device of the MULTI
+ * executable network
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_LATENCY, std::map<std::string, float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -37,6 +37,11 @@ static const char infer_requests_count_message[] = "Optional. Number of infer re
 /// @brief message for execution time
 static const char execution_time_message[] = "Optional. Time in seconds to execute topology.";
 
+/// @brief message for open-loop request rate
+static const char rate_message[] = "Optional. Target rate of inference requests per second for the open-loop mode (async API only). "
+                                   "Requests arrive at Poisson distributed times independently of completions, and the latency "
+                                   "is measured from the arrival, so it includes the time spent waiting for an idle request.";
+
 /// @brief message for #threads for CPU inference
 static const char infer_num_threads_message[] = "Optional. Number of threads to use for inference on the CPU "
                                                 "(including HETERO and MULTI cases).";
@@ -74,7 +79,9 @@ static const char report_type_message[] = "Optional. Enable collecting statistic
                                           "report extends \"no_counters\" report and additionally includes average PM "
                                           "counters values for each layer from the network. \"detailed_counters\" report "
                                           "extends \"average_counters\" report and additionally includes per-layer PM "
-                                          "counters and latency for each executed infer request.";
+                                          "counters and latency for each executed infer request. \"hw_counters\" report "
+                                          "extends \"average_counters\" report and additionally includes per-layer hardware "
+                                          "events (cycles, instructions, LLC misses) of the CPU device.";
 
 // @brief message for report_folder option
 static const char report_folder_message[] = "Optional. Path to a folder where statistics report is stored.";
@@ -142,6 +149,9 @@ DEFINE_uint32(t, 0, execution_time_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint32(nireq, 0, infer_requests_count_message);
 
+/// @brief Target rate of inference requests per second, 0 means the closed-loop mode
+DEFINE_double(rate, 0.0, rate_message);
+
 /// @brief Number of threads to use for inference on the CPU in throughput mode (also affects Hetero cases)
 DEFINE_uint32(nthreads, 0, infer_num_threads_message);
 
@@ -211,6 +221,7 @@ static void showUsage() {
     std::cout << "    -b \"<integer>\"            " << batch_size_message << std::endl;
     std::cout << "    -stream_output            " << stream_output_message << std::endl;
     std::cout << "    -t                        " << execution_time_message << std::endl;
+    std::cout << "    -rate \"<float>\"           " << rate_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
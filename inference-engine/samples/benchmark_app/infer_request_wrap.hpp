@@ -42,7 +42,12 @@ public:
     }
 
     void startAsync() {
-        _startTime = Time::now();
+        startAsync(Time::now());
+    }
+
+    /// @brief Starts the request which arrived at the given time, the latency is counted from the arrival
+    void startAsync(Time::time_point arrivalTime) {
+        _startTime = arrivalTime;
         _request.StartAsync();
     }
 
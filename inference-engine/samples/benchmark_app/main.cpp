@@ -6,7 +6,9 @@
 #include <chrono>
 #include <memory>
 #include <map>
+#include <random>
 #include <string>
+#include <thread>
 #include <vector>
 #include <utility>
 
@@ -56,13 +58,24 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
     }
 
     if (!FLAGS_report_type.empty() &&
-        FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport) {
+        FLAGS_report_type != noCntReport && FLAGS_report_type != averageCntReport && FLAGS_report_type != detailedCntReport &&
+        FLAGS_report_type != hwCntReport) {
         std::string err = "only " + std::string(noCntReport) + "/" + std::string(averageCntReport) + "/" + std::string(detailedCntReport) +
+                          "/" + std::string(hwCntReport) +
                           " report types are supported (invalid -report_type option value)";
         throw std::logic_error(err);
     }
 
-    if ((FLAGS_report_type == averageCntReport) && ((FLAGS_d.find("MULTI") != std::string::npos))) {
+    if (FLAGS_rate < 0.0) {
+        throw std::logic_error("Incorrect request rate. Please set -rate option to a positive value.");
+    }
+
+    if (FLAGS_rate > 0.0 && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop mode is supported for async API only. Please set -api option to `async` value.");
+    }
+
+    if ((FLAGS_report_type == averageCntReport || FLAGS_report_type == hwCntReport) &&
+        ((FLAGS_d.find("MULTI") != std::string::npos))) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
@@ -93,15 +106,6 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
-}
-
 /**
 * @brief The entry point of the benchmark application
 */
@@ -203,7 +207,8 @@ int main(int argc, char *argv[]) {
                       (device_config.at(CONFIG_KEY(PERF_COUNT)) == "YES")) {
                 slog::warn << "Performance counters for " << device <<
                               " device is turned on. To print results use -pc option." << slog::endl;
-            } else if (FLAGS_report_type == detailedCntReport || FLAGS_report_type == averageCntReport) {
+            } else if (FLAGS_report_type == detailedCntReport || FLAGS_report_type == averageCntReport ||
+                       FLAGS_report_type == hwCntReport) {
                 slog::warn << "Turn on performance counters for " << device <<
                               " device since report type is " << FLAGS_report_type << "." << slog::endl;
                 device_config[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
@@ -243,6 +248,9 @@ int main(int argc, char *argv[]) {
                 if (isFlagSetInCommandLine("nthreads"))
                     device_config[CONFIG_KEY(CPU_THREADS_NUM)] = std::to_string(FLAGS_nthreads);
 
+                if (FLAGS_report_type == hwCntReport)
+                    device_config[CONFIG_KEY(CPU_HW_PERF_COUNTERS)] = CONFIG_VALUE(YES);
+
                 if (isFlagSetInCommandLine("enforcebf16"))
                     device_config[CONFIG_KEY(ENFORCE_BF16)] = FLAGS_enforcebf16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO);
 
@@ -420,9 +428,12 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        // Open-loop mode does not wait for idle requests to issue the next one
+        const bool openLoop = FLAGS_rate > 0.0;
+
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -451,6 +462,7 @@ int main(int argc, char *argv[]) {
                                               {"batch size", std::to_string(batchSize)},
                                               {"number of iterations", std::to_string(niter)},
                                               {"number of parallel infer requests", std::to_string(nireq)},
+                                              {"target request rate", openLoop ? double_to_string(FLAGS_rate) : "closed loop"},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
             for (auto& nstreams : device_nstreams) {
@@ -497,6 +509,9 @@ int main(int argc, char *argv[]) {
         if (duration_seconds > 0) {
             ss << getDurationInMilliseconds(duration_seconds) << " ms duration";
         }
+        if (openLoop) {
+            ss << ", Poisson arrivals at " << FLAGS_rate << " requests/s";
+        }
         if (niter != 0) {
             if (duration_seconds == 0) {
                 progressBarTotalCount = niter;
@@ -535,9 +550,19 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
+        // Interarrival times of the Poisson process are exponentially distributed
+        std::mt19937 generator(std::random_device{}());
+        std::exponential_distribution<double> interarrivalTime(openLoop ? FLAGS_rate : 1.0);
+        auto arrivalTime = Time::now();
+
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !openLoop && iteration % nireq != 0)) {
+            if (openLoop) {
+                arrivalTime += std::chrono::duration_cast<Time::duration>(
+                    std::chrono::duration<double>(interarrivalTime(generator)));
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -552,7 +577,11 @@ int main(int argc, char *argv[]) {
                 // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
                 // So, rechecking for any exceptions here.
                 inferRequest->wait();
-                inferRequest->startAsync();
+                if (openLoop) {
+                    inferRequest->startAsync(arrivalTime);
+                } else {
+                    inferRequest->startAsync();
+                }
             }
             iteration++;
 
@@ -574,7 +603,8 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        LatencyMetrics latencyMetrics(inferRequestsQueue.getLatencies());
+        double latency = latencyMetrics.median();
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
@@ -590,6 +620,7 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                statistics->addLatencyMetrics(latencyMetrics);
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -634,13 +665,27 @@ int main(int argc, char *argv[]) {
             }
         }
 
+        if (statistics && FLAGS_report_type == hwCntReport) {
+            try {
+                statistics->dumpHwPerformanceCounters(
+                    exeNetwork.GetMetric(METRIC_KEY(HW_PERF_COUNTERS)).as<StatisticsReport::HwPerformanceCounters>());
+            } catch (const std::exception & ex) {
+                slog::warn << "Can't get hardware performance counters: " << ex.what() << slog::endl;
+            }
+        }
+
         if (statistics)
             statistics->dump();
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "    p90:    " << double_to_string(latencyMetrics.percentile(90)) << " ms" << std::endl;
+            std::cout << "    p99:    " << double_to_string(latencyMetrics.percentile(99)) << " ms" << std::endl;
+            std::cout << "    p99.9:  " << double_to_string(latencyMetrics.percentile(99.9)) << " ms" << std::endl;
+            std::cout << "    max:    " << double_to_string(latencyMetrics.max()) << " ms" << std::endl;
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
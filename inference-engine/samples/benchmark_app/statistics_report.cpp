@@ -7,9 +7,42 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <iomanip>
+#include <sstream>
 
 #include "statistics_report.hpp"
 
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) : _sorted(latencies) {
+    if (_sorted.empty())
+        return;
+    std::sort(_sorted.begin(), _sorted.end());
+    _median = (_sorted.size() % 2 != 0) ?
+              _sorted[_sorted.size() / 2ULL] :
+              (_sorted[_sorted.size() / 2ULL] + _sorted[_sorted.size() / 2ULL - 1ULL]) / 2.0;
+    _average = std::accumulate(_sorted.begin(), _sorted.end(), 0.0) / _sorted.size();
+}
+
+double LatencyMetrics::percentile(double percent) const {
+    if (_sorted.empty())
+        return 0.0;
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * _sorted.size()));
+    return _sorted[std::min(std::max<size_t>(rank, 1), _sorted.size()) - 1];
+}
+
+std::vector<size_t> LatencyMetrics::histogram(size_t bins) const {
+    std::vector<size_t> counts(bins, 0);
+    if (_sorted.empty() || bins == 0)
+        return counts;
+    const double width = (max() - min()) / bins;
+    for (auto latency : _sorted) {
+        auto bin = width > 0.0 ? static_cast<size_t>((latency - min()) / width) : 0;
+        counts[std::min(bin, bins - 1)]++;
+    }
+    return counts;
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -17,6 +50,34 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addLatencyMetrics(const LatencyMetrics& latency, size_t histogramBins) {
+    auto to_string = [] (const double number) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << number;
+        return ss.str();
+    };
+    addParameters(Category::EXECUTION_RESULTS,
+                  {
+                          {"latency p50 (ms)", to_string(latency.percentile(50))},
+                          {"latency p90 (ms)", to_string(latency.percentile(90))},
+                          {"latency p99 (ms)", to_string(latency.percentile(99))},
+                          {"latency p99.9 (ms)", to_string(latency.percentile(99.9))},
+                          {"latency average (ms)", to_string(latency.average())},
+                          {"latency min (ms)", to_string(latency.min())},
+                          {"latency max (ms)", to_string(latency.max())},
+                  });
+
+    const auto counts = latency.histogram(histogramBins);
+    const double width = (latency.max() - latency.min()) / histogramBins;
+    Parameters histogram;
+    for (size_t i = 0; i < counts.size(); i++) {
+        histogram.push_back({"[" + to_string(latency.min() + i * width) + ", " +
+                             to_string(latency.min() + (i + 1) * width) + (i + 1 == counts.size() ? "]" : ")"),
+                             std::to_string(counts[i])});
+    }
+    addParameters(Category::LATENCY_HISTOGRAM, histogram);
+}
+
 void StatisticsReport::dump() {
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
@@ -50,6 +111,14 @@ void StatisticsReport::dump() {
         dumper.endLine();
     }
 
+    if (_parameters.count(Category::LATENCY_HISTOGRAM)) {
+        dumper << "Latency histogram (ms)";
+        dumper.endLine();
+
+        dump_parameters(_parameters.at(Category::LATENCY_HISTOGRAM));
+        dumper.endLine();
+    }
+
     slog::info << "Statistics report is stored to " << dumper.getFilename() << slog::endl;
 }
 
@@ -104,7 +173,7 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
         for (auto& pc : perfCounts) {
             dumpPerformanceCountersRequest(dumper, pc);
         }
-    } else if (_config.report_type == averageCntReport) {
+    } else if (_config.report_type == averageCntReport || _config.report_type == hwCntReport) {
         auto getAveragePerformanceCounters = [ &perfCounts ] () {
             std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> performanceCountersAvg;
             // iterate over each processed infer request and handle its PM data
@@ -132,3 +201,46 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Pefromance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+void StatisticsReport::dumpHwPerformanceCounters(const HwPerformanceCounters &perfCounts) {
+    if (perfCounts.empty()) {
+        slog::info << "Hardware performance counters are empty. No reports are dumped." << slog::endl;
+        return;
+    }
+    // The memory traffic is estimated as a cache line read for every last level cache miss
+    const double cacheLineSize = 64.0;
+    auto value = [] (const std::map<std::string, uint64_t>& counters, const char* name) {
+        auto it = counters.find(name);
+        return it == counters.end() ? 0.0 : static_cast<double>(it->second);
+    };
+
+    std::vector<std::pair<std::string, std::map<std::string, uint64_t>>> layers(perfCounts.begin(), perfCounts.end());
+    std::sort(layers.begin(), layers.end(), [&] (const std::pair<std::string, std::map<std::string, uint64_t>>& a,
+                                                 const std::pair<std::string, std::map<std::string, uint64_t>>& b) {
+        return value(a.second, METRIC_VALUE(REAL_TIME_NS)) > value(b.second, METRIC_VALUE(REAL_TIME_NS));
+    });
+
+    CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_hw_events_report.csv");
+    dumper << "layerName" << "executions" << "realTime (ms)" << "cycles" << "instructions" << "IPC";
+    dumper << "LLC references" << "LLC misses" << "LLC miss rate (%)" << "est. bandwidth (GB/s)";
+    dumper.endLine();
+
+    for (const auto& layer : layers) {
+        const double executions = std::max(value(layer.second, METRIC_VALUE(EXECUTIONS)), 1.0);
+        const double timeNs = value(layer.second, METRIC_VALUE(REAL_TIME_NS));
+        const double cycles = value(layer.second, METRIC_VALUE(CPU_CYCLES));
+        const double instructions = value(layer.second, METRIC_VALUE(INSTRUCTIONS));
+        const double references = value(layer.second, METRIC_VALUE(LLC_REFERENCES));
+        const double misses = value(layer.second, METRIC_VALUE(LLC_MISSES));
+
+        dumper << layer.first << static_cast<uint64_t>(executions);
+        dumper << timeNs / executions / 1e6 << cycles / executions << instructions / executions;
+        dumper << (cycles > 0 ? instructions / cycles : 0.0);
+        dumper << references / executions << misses / executions;
+        dumper << (references > 0 ? 100.0 * misses / references : 0.0);
+        // bytes per nanosecond are gigabytes per second
+        dumper << (timeNs > 0 ? misses * cacheLineSize / timeNs : 0.0);
+        dumper.endLine();
+    }
+    slog::info << "Hardware performance counters report is stored to " << dumper.getFilename() << slog::endl;
+}
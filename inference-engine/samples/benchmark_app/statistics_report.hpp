@@ -18,11 +18,37 @@
 static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
+static constexpr char hwCntReport[] = "hw_counters";
+
+/// @brief Distribution of the infer requests latencies
+class LatencyMetrics {
+public:
+    LatencyMetrics() = default;
+
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    /// @brief Nearest-rank percentile of the latencies, percent is in the (0, 100] range
+    double percentile(double percent) const;
+
+    double median() const { return _median; }
+    double average() const { return _average; }
+    double min() const { return _sorted.empty() ? 0.0 : _sorted.front(); }
+    double max() const { return _sorted.empty() ? 0.0 : _sorted.back(); }
+
+    /// @brief Numbers of latencies in the bins of the same width between min and max
+    std::vector<size_t> histogram(size_t bins) const;
+
+private:
+    std::vector<double> _sorted;
+    double _median = 0.0;
+    double _average = 0.0;
+};
 
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
     typedef std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> PerformaceCounters;
+    typedef std::map<std::string, std::map<std::string, uint64_t>> HwPerformanceCounters;
     typedef std::vector<std::pair<std::string, std::string>> Parameters;
 
     struct Config {
@@ -34,6 +60,7 @@ public:
         COMMAND_LINE_PARAMETERS,
         RUNTIME_CONFIG,
         EXECUTION_RESULTS,
+        LATENCY_HISTOGRAM,
     };
 
     explicit StatisticsReport(Config config) : _config(std::move(config)) {
@@ -53,10 +80,15 @@ public:
 
     void addParameters(const Category &category, const Parameters& parameters);
 
+    void addLatencyMetrics(const LatencyMetrics& latency, size_t histogramBins = 20);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
 
+    /// @brief Dumps per-layer totals of the HW_PERF_COUNTERS metric, the slowest layers go first
+    void dumpHwPerformanceCounters(const HwPerformanceCounters &perfCounts);
+
 private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
@@ -21,6 +21,7 @@
 #endif
 
 #include "runtime/floatmath.h"
+#include "runtime/floatmath_kernels.hpp"
 #include "dnn.hpp"
 #include "gna_plugin_log.hpp"
 #include "runtime/pwl.h"
@@ -97,11 +98,13 @@ void GNAPluginNS::backend::ApplyDiagonalTransform(intel_dnn_component_t *compone
             C[i * ldc + j] = bias[i];
         }
     }
-    for (uint32_t j = 0; j < n; j++) {
-        float *Bcol = B + j * ldb;
-        float *Ccol = C + j * ldc;
-        cblas_ssbmv1(CblasRowMajor, CblasLower, m, 0, 1.0, A, 1, Bcol, 1, 1.0, Ccol, 1);
-    }
+    GNAPluginNS::runtime::ParallelBlocks(m, 4096, [&](int begin, int end) {
+        for (uint32_t j = 0; j < n; j++) {
+            float *Bcol = B + j * ldb + begin;
+            float *Ccol = C + j * ldc + begin;
+            cblas_ssbmv1(CblasRowMajor, CblasLower, end - begin, 0, 1.0, A + begin, 1, Bcol, 1, 1.0, Ccol, 1);
+        }
+    });
 }
 
 void GNAPluginNS::backend::ApplyRecurrentTransform(intel_dnn_component_t *component, uint32_t row, void *ptr_feedbacks) {
@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <limits>
 #include <cstdint>
 #include <cstdio>
 #include <gna_plugin_log.hpp>
 
 #include "cnn.h"
+#include "floatmath_kernels.hpp"
 #include "backend/dnn_types.h"
 
 
@@ -32,17 +34,18 @@ void CNNFilter32(intel_dnn_component_t *component) {
         THROW_GNA_EXCEPTION << "Bad num_columns_out in CNNFilter32!" << layer_name;
     }
 
-    for (uint32_t j = 0; j < num_filter_outputs; j++) {
-        float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
-        for (uint32_t i = 0; i < component->op.conv1D.num_filters; i++) {
-            float *ptr_coef = ptr_filters + i * num_filter_coefficients;
-            float sum = ptr_biases[i];
-            for (uint32_t k = 0; k < num_filter_coefficients; k++) {
-                sum += ptr_in[k] * ptr_coef[k];
-            }
-            ptr_outputs[j * component->op.conv1D.num_filters + i] = sum;
+    // every output position is the product of the filters and the input band, the positions run in parallel
+    const uint32_t num_filters = component->op.conv1D.num_filters;
+    const auto &kernels = GNAPluginNS::runtime::FloatKernels();
+    GNAPluginNS::runtime::ParallelBlocks(num_filter_outputs, 4, [&](int begin, int end) {
+        for (int j = begin; j < end; j++) {
+            float *ptr_in = ptr_inputs + j * num_inputs_band_stride;
+            float *ptr_out = ptr_outputs + j * num_filters;
+            std::copy(ptr_biases, ptr_biases + num_filters, ptr_out);
+            kernels.dot(ptr_filters, num_filter_coefficients, nullptr, num_filters,
+                        ptr_in, num_filter_coefficients, ptr_out, 1);
         }
-    }
+    });
 }
 
 void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number_type) {
@@ -102,29 +105,12 @@ void CNNMaxPool(intel_dnn_component_t *component, intel_dnn_number_type_t number
         uint32_t num_pool_step = component->op.maxpool.num_inputs_step;
         uint32_t num_rows_in = num_inputs / component->op.maxpool.num_inputs_stride;
 
-        for (uint32_t i = 0; i < num_columns; i++) {
-            int32_t m = 0;
-            if (component->op.maxpool.do_sum_not_max) {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float sum = 0.0;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        sum += ptr_inputs[k * num_columns + i];
-                    }
-                    ptr_outputs[m * num_columns + i] = sum;
-                    m++;
-                }
-            } else {
-                for (uint32_t j = 0; j < num_rows_in; j += num_pool_step) {
-                    float max = -1e20f;
-                    uint32_t num_end = (j + num_pool_size > num_rows_in) ? num_rows_in : j + num_pool_size;
-                    for (uint32_t k = j; k < num_end; k++) {
-                        if (ptr_inputs[k * num_columns + i] > max) max = ptr_inputs[k * num_columns + i];
-                    }
-                    ptr_outputs[m * num_columns + i] = max;
-                    m++;
-                }
-            }
-        }
+        // the columns are pooled independently, the blocks of the columns run in parallel
+        const bool do_sum = component->op.maxpool.do_sum_not_max;
+        const auto &kernels = GNAPluginNS::runtime::FloatKernels();
+        GNAPluginNS::runtime::ParallelBlocks(num_columns, 64, [&](int begin, int end) {
+            kernels.pool(ptr_inputs + begin, ptr_outputs + begin, num_columns, end - begin,
+                         num_rows_in, num_pool_size, num_pool_step, do_sum);
+        });
     }
 }
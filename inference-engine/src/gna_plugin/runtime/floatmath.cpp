@@ -1,13 +1,80 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines of the software mode
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
+#include <vector>
+
+#include <ie_parallel.hpp>
 
 #include "floatmath.h"
+#include "floatmath_kernels.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+
+const float_kernels &FloatKernels() {
+    static const float_kernels kernels = [] {
+        float_kernels table;
+        XARCH::get_float_kernels(table);
+        return table;
+    }();
+    return kernels;
+}
+
+void ParallelBlocks(int count, int grain, const std::function<void(int, int)> &block) {
+    const int num_blocks = (count + grain - 1) / grain;
+    if (num_blocks <= 1) {
+        if (count > 0) {
+            block(0, count);
+        }
+        return;
+    }
+    InferenceEngine::parallel_for(num_blocks, [&](int b) {
+        block(b * grain, std::min(count, (b + 1) * grain));
+    });
+}
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
+
+namespace {
+
+// Rows of C per parallel block
+constexpr int rows_grain = 64;
+
+// C[r, :] += A[row(r), :] * B for the rows r in [0, num_rows) of C, the output list selects row(r)
+void sgemm_rows(const float *A, int lda, const float *B, int ldb, float *C, int ldc,
+                int k, int n, const uint32_t *rows, int num_rows) {
+    const auto &kernels = GNAPluginNS::runtime::FloatKernels();
+    if (n >= 8) {
+        // the frames are the vector lanes
+        GNAPluginNS::runtime::ParallelBlocks(num_rows, rows_grain, [&](int begin, int end) {
+            kernels.affine(rows != nullptr ? A : A + begin * lda, lda, B, ldb, C + begin * ldc, ldc, k, n,
+                           rows != nullptr ? rows + begin : nullptr, end - begin);
+        });
+        return;
+    }
+    // few frames: the inputs are transposed, so every output is the dot product of contiguous vectors
+    std::vector<float> transposed(static_cast<size_t>(n) * k);
+    for (int kk = 0; kk < k; kk++) {
+        for (int j = 0; j < n; j++) {
+            transposed[j * k + kk] = B[kk * ldb + j];
+        }
+    }
+    GNAPluginNS::runtime::ParallelBlocks(num_rows, rows_grain, [&](int begin, int end) {
+        for (int j = 0; j < n; j++) {
+            kernels.dot(rows != nullptr ? A : A + begin * lda, lda, rows != nullptr ? rows + begin : nullptr,
+                        end - begin, transposed.data() + j * k, k, C + begin * ldc + j, ldc);
+        }
+    });
+}
+
+}  // namespace
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +94,12 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                std::fill(C + i * ldc, C + i * ldc + N, 0.0f);
             }
         }
+        sgemm_rows(A, lda, B, ldb, C, ldc, K, N, nullptr, M);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -66,8 +130,6 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
                   const MKL_INT N, const MKL_INT K, const float alpha, const float *A,
                   const MKL_INT lda, const float *X, const MKL_INT incX,
                   const float beta, float *Y, const MKL_INT incY) {
-    int i;
-
     if (Layout != CblasRowMajor) {
         fprintf(stderr, "Only row major is supported in cblas_ssbmv!\n");
         throw -1;
@@ -81,9 +143,7 @@ void cblas_ssbmv1(const CBLAS_LAYOUT Layout, const CBLAS_UPLO Uplo,
         throw -1;
     }
     if ((alpha == 1.0) && (beta == 1.0) && (incX == 1) && (incY == 1)) {
-        for (i = 0; i < N; i++) {
-            Y[i] += A[i] * X[i];
-        }
+        GNAPluginNS::runtime::FloatKernels().diagonal(A, X, Y, N);
     } else {
         fprintf(stderr, "Only alpha=1, beta=1, incX=1, incY=1, LDA=1 supported in cblas_ssbmv at this time!\n");
         throw -1;
@@ -105,16 +165,12 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+        if (beta != 1.0) {
+            for (l = 0; l < L; l++) {
+                std::fill(C + l * ldc, C + l * ldc + N, 0.0f);
             }
         }
+        sgemm_rows(A, lda, B, ldb, C, ldc, K, N, OutputList, L);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -0,0 +1,270 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "floatmath_kernels.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+#if defined(HAVE_AVX512F)
+#define GNA_FLOAT_SIMD
+using vec = __m512;
+constexpr int vlen = 16;
+inline vec vzero() { return _mm512_setzero_ps(); }
+inline vec vset1(float value) { return _mm512_set1_ps(value); }
+inline vec vload(const float *ptr, int count) {
+    return count == vlen ? _mm512_loadu_ps(ptr) : _mm512_maskz_loadu_ps((1u << count) - 1, ptr);
+}
+inline void vstore(float *ptr, vec value, int count) {
+    if (count == vlen) {
+        _mm512_storeu_ps(ptr, value);
+    } else {
+        _mm512_mask_storeu_ps(ptr, (1u << count) - 1, value);
+    }
+}
+inline vec vfmadd(vec a, vec b, vec c) { return _mm512_fmadd_ps(a, b, c); }
+inline vec vadd(vec a, vec b) { return _mm512_add_ps(a, b); }
+inline vec vmax(vec a, vec b) { return _mm512_max_ps(a, b); }
+inline vec vmin(vec a, vec b) { return _mm512_min_ps(a, b); }
+inline float vsum(vec a) { return _mm512_reduce_add_ps(a); }
+#elif defined(HAVE_AVX2)
+#define GNA_FLOAT_SIMD
+using vec = __m256;
+constexpr int vlen = 8;
+inline __m256i vmask(int count) {
+    return _mm256_cmpgt_epi32(_mm256_set1_epi32(count), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+inline vec vzero() { return _mm256_setzero_ps(); }
+inline vec vset1(float value) { return _mm256_set1_ps(value); }
+inline vec vload(const float *ptr, int count) {
+    return count == vlen ? _mm256_loadu_ps(ptr) : _mm256_maskload_ps(ptr, vmask(count));
+}
+inline void vstore(float *ptr, vec value, int count) {
+    if (count == vlen) {
+        _mm256_storeu_ps(ptr, value);
+    } else {
+        _mm256_maskstore_ps(ptr, vmask(count), value);
+    }
+}
+inline vec vfmadd(vec a, vec b, vec c) { return _mm256_fmadd_ps(a, b, c); }
+inline vec vadd(vec a, vec b) { return _mm256_add_ps(a, b); }
+inline vec vmax(vec a, vec b) { return _mm256_max_ps(a, b); }
+inline vec vmin(vec a, vec b) { return _mm256_min_ps(a, b); }
+inline float vsum(vec a) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+#endif
+
+inline int row_index(const uint32_t *rows, int r) {
+    return rows == nullptr ? r : static_cast<int>(rows[r]);
+}
+
+// R rows of C share every loaded row of B
+template <int R>
+void affine_block(const float *A, int lda, const float *B, int ldb, float *C, int ldc,
+                  int k, int n, const uint32_t *rows, int r) {
+    const float *a[R];
+    float *c[R];
+    for (int t = 0; t < R; t++) {
+        a[t] = A + row_index(rows, r + t) * lda;
+        c[t] = C + (r + t) * ldc;
+    }
+    int j = 0;
+#ifdef GNA_FLOAT_SIMD
+    for (; j < n; j += vlen) {
+        const int count = std::min(vlen, n - j);
+        vec acc[R];
+        for (int t = 0; t < R; t++) {
+            acc[t] = vload(c[t] + j, count);
+        }
+        for (int kk = 0; kk < k; kk++) {
+            const vec b = vload(B + kk * ldb + j, count);
+            for (int t = 0; t < R; t++) {
+                acc[t] = vfmadd(vset1(a[t][kk]), b, acc[t]);
+            }
+        }
+        for (int t = 0; t < R; t++) {
+            vstore(c[t] + j, acc[t], count);
+        }
+    }
+#endif
+    for (; j < n; j++) {
+        float sum[R];
+        for (int t = 0; t < R; t++) {
+            sum[t] = c[t][j];
+        }
+        for (int kk = 0; kk < k; kk++) {
+            const float b = B[kk * ldb + j];
+            for (int t = 0; t < R; t++) {
+                sum[t] += a[t][kk] * b;
+            }
+        }
+        for (int t = 0; t < R; t++) {
+            c[t][j] = sum[t];
+        }
+    }
+}
+
+void affine(const float *A, int lda, const float *B, int ldb, float *C, int ldc,
+            int k, int n, const uint32_t *rows, int num_rows) {
+    int r = 0;
+    for (; r + 4 <= num_rows; r += 4) {
+        affine_block<4>(A, lda, B, ldb, C, ldc, k, n, rows, r);
+    }
+    for (; r < num_rows; r++) {
+        affine_block<1>(A, lda, B, ldb, C, ldc, k, n, rows, r);
+    }
+}
+
+// R rows of A share every loaded block of x
+template <int R>
+void dot_block(const float *A, int lda, const uint32_t *rows, int r, const float *x, int k, float *y, int ldy) {
+    const float *a[R];
+    for (int t = 0; t < R; t++) {
+        a[t] = A + row_index(rows, r + t) * lda;
+    }
+    float sum[R] = {};
+    int kk = 0;
+#ifdef GNA_FLOAT_SIMD
+    vec acc[R];
+    for (int t = 0; t < R; t++) {
+        acc[t] = vzero();
+    }
+    for (; kk + vlen <= k; kk += vlen) {
+        const vec b = vload(x + kk, vlen);
+        for (int t = 0; t < R; t++) {
+            acc[t] = vfmadd(vload(a[t] + kk, vlen), b, acc[t]);
+        }
+    }
+    if (kk < k) {
+        const int count = k - kk;
+        const vec b = vload(x + kk, count);
+        for (int t = 0; t < R; t++) {
+            acc[t] = vfmadd(vload(a[t] + kk, count), b, acc[t]);
+        }
+        kk = k;
+    }
+    for (int t = 0; t < R; t++) {
+        sum[t] = vsum(acc[t]);
+    }
+#endif
+    for (; kk < k; kk++) {
+        for (int t = 0; t < R; t++) {
+            sum[t] += a[t][kk] * x[kk];
+        }
+    }
+    for (int t = 0; t < R; t++) {
+        y[(r + t) * ldy] += sum[t];
+    }
+}
+
+void dot(const float *A, int lda, const uint32_t *rows, int num_rows, const float *x, int k, float *y, int ldy) {
+    int r = 0;
+    for (; r + 4 <= num_rows; r += 4) {
+        dot_block<4>(A, lda, rows, r, x, k, y, ldy);
+    }
+    for (; r < num_rows; r++) {
+        dot_block<1>(A, lda, rows, r, x, k, y, ldy);
+    }
+}
+
+void diagonal(const float *a, const float *x, float *y, int count) {
+    int i = 0;
+#ifdef GNA_FLOAT_SIMD
+    for (; i < count; i += vlen) {
+        const int block = std::min(vlen, count - i);
+        vstore(y + i, vfmadd(vload(a + i, block), vload(x + i, block), vload(y + i, block)), block);
+    }
+#endif
+    for (; i < count; i++) {
+        y[i] += a[i] * x[i];
+    }
+}
+
+void pool(const float *in, float *out, int stride, int count, int num_rows, int pool_size, int pool_step, bool sum) {
+    const float initial = sum ? 0.0f : -1e20f;
+    int i = 0;
+#ifdef GNA_FLOAT_SIMD
+    for (; i < count; i += vlen) {
+        const int block = std::min(vlen, count - i);
+        for (int j = 0, m = 0; j < num_rows; j += pool_step, m++) {
+            const int end = std::min(j + pool_size, num_rows);
+            vec acc = vset1(initial);
+            for (int r = j; r < end; r++) {
+                const vec value = vload(in + r * stride + i, block);
+                acc = sum ? vadd(acc, value) : vmax(acc, value);
+            }
+            vstore(out + m * stride + i, acc, block);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        for (int j = 0, m = 0; j < num_rows; j += pool_step, m++) {
+            const int end = std::min(j + pool_size, num_rows);
+            float acc = initial;
+            for (int r = j; r < end; r++) {
+                const float value = in[r * stride + i];
+                acc = sum ? acc + value : std::max(acc, value);
+            }
+            out[m * stride + i] = acc;
+        }
+    }
+}
+
+void relu(const float *in, float *out, int count, float negative_slope) {
+    int i = 0;
+#ifdef GNA_FLOAT_SIMD
+    const vec zero = vzero();
+    const vec slope = vset1(negative_slope);
+    for (; i < count; i += vlen) {
+        const int block = std::min(vlen, count - i);
+        const vec value = vload(in + i, block);
+        vstore(out + i, vfmadd(vmin(value, zero), slope, vmax(value, zero)), block);
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = in[i] < 0.0f ? in[i] * negative_slope : in[i];
+    }
+}
+
+void clamp(const float *in, float *out, int count, float low, float high) {
+    int i = 0;
+#ifdef GNA_FLOAT_SIMD
+    const vec vlow = vset1(low);
+    const vec vhigh = vset1(high);
+    for (; i < count; i += vlen) {
+        const int block = std::min(vlen, count - i);
+        vstore(out + i, vmin(vmax(vload(in + i, block), vlow), vhigh), block);
+    }
+#endif
+    for (; i < count; i++) {
+        out[i] = std::min(std::max(in[i], low), high);
+    }
+}
+
+}  // namespace
+
+void get_float_kernels(float_kernels &kernels) {
+    kernels.affine = affine;
+    kernels.dot = dot;
+    kernels.diagonal = diagonal;
+    kernels.pool = pool;
+    kernels.relu = relu;
+    kernels.clamp = clamp;
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace GNAPluginNS {
+namespace runtime {
+
+/**
+ * @brief Blocked kernels of the floating point software mode. Row major matrices, every kernel processes
+ * the block given by its arguments, the callers split the work between the threads.
+ */
+struct float_kernels {
+    // C[r, 0:n) += A[row(r), 0:k) * B[0:k, 0:n) for r in [0, num_rows), row(r) is rows[r] or r if rows is nullptr
+    void (*affine)(const float *A, int lda, const float *B, int ldb, float *C, int ldc,
+                   int k, int n, const uint32_t *rows, int num_rows);
+    // y[r * ldy] += A[row(r), 0:k) . x[0:k) for r in [0, num_rows), row(r) is rows[r] or r if rows is nullptr
+    void (*dot)(const float *A, int lda, const uint32_t *rows, int num_rows, const float *x, int k,
+                float *y, int ldy);
+    // y[i] += a[i] * x[i] for i in [0, count)
+    void (*diagonal)(const float *a, const float *x, float *y, int count);
+    // out[p * stride + i] = max (or sum) of in[r * stride + i] over the rows r of the pooling window p,
+    // i in [0, count)
+    void (*pool)(const float *in, float *out, int stride, int count, int num_rows, int pool_size, int pool_step,
+                 bool sum);
+    // out[i] = in[i] < 0 ? in[i] * negative_slope : in[i] for i in [0, count)
+    void (*relu)(const float *in, float *out, int count, float negative_slope);
+    // out[i] = min(max(in[i], low), high) for i in [0, count)
+    void (*clamp)(const float *in, float *out, int count, float low, float high);
+};
+
+/**
+ * @brief Returns the kernels compiled for the best instruction set supported by the host
+ */
+const float_kernels &FloatKernels();
+
+/**
+ * @brief Splits [0, count) into the blocks of grain elements and runs them in parallel
+ */
+void ParallelBlocks(int count, int grain, const std::function<void(int, int)> &block);
+
+namespace XARCH {
+
+void get_float_kernels(float_kernels &kernels);
+
+}  // namespace XARCH
+
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -9,6 +9,7 @@
 #include <limits>
 #include <cstdint>
 #include <algorithm>
+#include <functional>
 
 #ifdef _NO_MKL_
 #include <cmath>
@@ -25,6 +26,7 @@
 #endif
 
 #include "pwl.h"
+#include "floatmath_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -939,110 +941,99 @@ void PwlApply32(intel_dnn_component_t *component,
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
     uint32_t num_columns = component->num_columns_in;
+    const auto &kernels = GNAPluginNS::runtime::FloatKernels();
+    // applies the function to count contiguous elements
+    std::function<void(const float *, float *, int)> apply;
     switch (transform->func_id.type) {
         case kActSigmoid:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = 0.5 * (1.0 + tanh(0.5 * ptr_in[i * num_columns + j]));
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = 0.5 * (1.0 + tanh(0.5 * in[j]));
                 }
-            }
+            };
             break;
         case kActTanh:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = tanh(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = tanh(in[j]);
                 }
-            }
+            };
             break;
         case kActSoftSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j] / (1.0 + fabs(ptr_in[i * num_columns + j]));
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = in[j] / (1.0 + fabs(in[j]));
                 }
-            }
+            };
             break;
-        case kActRelu:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] =
-                        (ptr_in[i * num_columns + j] < 0.0f) ?
-                            ptr_in[i * num_columns + j] * transform->func_id.args.lrelu.negative_slope :
-                            ptr_in[i * num_columns + j];
-                }
+        case kActRelu: {
+                const float negative_slope = transform->func_id.args.lrelu.negative_slope;
+                apply = [&kernels, negative_slope](const float *in, float *out, int count) {
+                    kernels.relu(in, out, count, negative_slope);
+                };
             }
             break;
         case kActIdentity:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = ptr_in[i * num_columns + j];
-                }
-            }
+            apply = [](const float *in, float *out, int count) {
+                std::copy(in, in + count, out);
+            };
             break;
         case kActKaldiLstmClipping:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    float val = ptr_in[i * num_columns + j];
-                    if (val > KALDI_LSTM_CLIP_UPPER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_UPPER;
-                    } else if (val < KALDI_LSTM_CLIP_LOWER) {
-                        ptr_out[i * num_columns + j] = KALDI_LSTM_CLIP_LOWER;
-                    } else {
-                        ptr_out[i * num_columns + j] = val;
-                    }
-                }
-            }
+            apply = [&kernels](const float *in, float *out, int count) {
+                kernels.clamp(in, out, count, KALDI_LSTM_CLIP_LOWER, KALDI_LSTM_CLIP_UPPER);
+            };
             break;
         case kActExp:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = exp(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = exp(in[j]);
                 }
-            }
+            };
             break;
         case kActLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = log(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = log(in[j]);
                 }
-            }
+            };
             break;
         case kActAbs:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = fabs(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = fabs(in[j]);
                 }
-            }
+            };
             break;
         case kActSign:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = (ptr_in[i * num_columns + j] == 0) ? 0.0 : ((ptr_in[i * num_columns + j] > 0) ? 1.0 : -1.0);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = (in[j] == 0) ? 0.0 : ((in[j] > 0) ? 1.0 : -1.0);
                 }
-            }
+            };
             break;
         case kActNegLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -1.0 * log(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = -1.0 * log(in[j]);
                 }
-            }
+            };
             break;
         case kActNegHalfLog:
-            for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                    ptr_out[i * num_columns + j] = -0.5 * log(ptr_in[i * num_columns + j]);
+            apply = [](const float *in, float *out, int count) {
+                for (int j = 0; j < count; j++) {
+                    out[j] = -0.5 * log(in[j]);
                 }
-            }
+            };
             break;
         case kActPow: {
                 float exponent = transform->func_id.args.pow.exponent;
                 float scale = transform->func_id.args.pow.scale;
                 float offset = transform->func_id.args.pow.offset;
-                for (uint32_t i = num_row_start; i <= num_row_end; i++) {
-                    for (uint32_t j = num_col_start; j <= num_col_end; j++) {
-                        ptr_out[i * num_columns + j] = pow(offset + scale * ptr_in[i * num_columns + j], exponent);
+                apply = [exponent, scale, offset](const float *in, float *out, int count) {
+                    for (int j = 0; j < count; j++) {
+                        out[j] = pow(offset + scale * in[j], exponent);
                     }
-                }
+                };
             }
             break;
         case kActCustom:
@@ -1050,4 +1041,13 @@ void PwlApply32(intel_dnn_component_t *component,
         default:fprintf(stderr, "Unknown piecewise linear function type!\n");
             throw -1;
     }
+
+    // the rows are independent, the blocks of the rows run in parallel
+    const int num_rows = num_row_end - num_row_start + 1;
+    const int count = num_col_end - num_col_start + 1;
+    GNAPluginNS::runtime::ParallelBlocks(num_rows, std::max(1, 4096 / std::max(1, count)), [&](int begin, int end) {
+        for (int i = num_row_start + begin; i < num_row_start + end; i++) {
+            apply(ptr_in + i * num_columns + num_col_start, ptr_out + i * num_columns + num_col_start, count);
+        }
+    });
 }
@@ -4,6 +4,8 @@
 
 #include <utility>
 #include <memory>
+#include <map>
+#include <string>
 #include "hetero_async_infer_request.hpp"
 
 using namespace HeteroPlugin;
@@ -11,11 +13,30 @@ using namespace InferenceEngine;
 
 HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr& request,
                                                  const ITaskExecutor::Ptr&      taskExecutor,
-                                                 const ITaskExecutor::Ptr&      callbackExecutor) :
+                                                 const ITaskExecutor::Ptr&      callbackExecutor,
+                                                 const std::vector<HeteroPipelineStage::Ptr>& pipelineStages) :
     AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
     _heteroInferRequest(request),
-    _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK} {
+    _statusCodes{_heteroInferRequest->_inferRequests.size(), StatusCode::OK},
+    _pipelineStages{pipelineStages},
+    _pipelineSlots(pipelineStages.size(), nullptr) {
     _pipeline.clear();
+    if (!_pipelineStages.empty()) {
+        for (std::size_t stage = 0; stage < _pipelineStages.size(); ++stage) {
+            struct StageExecutor : ITaskExecutor {
+                StageExecutor(HeteroAsyncInferRequest* request, std::size_t stage) : _request{request}, _stage{stage} {}
+                void run(Task task) override {
+                    _request->RunPipelineStage(_stage, std::move(task));
+                }
+                HeteroAsyncInferRequest*    _request = nullptr;
+                std::size_t                 _stage = 0;
+            };
+            _pipeline.emplace_back(std::make_shared<StageExecutor>(this, stage), [this, stage] {
+                CompletePipelineStage(stage);
+            });
+        }
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
@@ -44,11 +65,100 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&
     }
 }
 
+void HeteroAsyncInferRequest::RunPipelineStage(std::size_t stage, Task task) {
+    _pipelineStages[stage]->Run([this, stage, task] (HeteroPipelineStage::Slot* slot) {
+        _pipelineSlots[stage] = slot;
+        try {
+            SetPipelineStageBlobs(stage, slot);
+            _pipelineStages[stage]->StartAsync(slot, task);
+        } catch (...) {
+            _pipelineException = std::current_exception();
+            task();
+        }
+    });
+}
+
+void HeteroAsyncInferRequest::SetPipelineStageBlobs(std::size_t stage, HeteroPipelineStage::Slot* slot) {
+    auto& request = *(slot->_request);
+    for (auto&& input : _pipelineStages[stage]->_inputs) {
+        if (input._producer < 0) {
+            Blob::Ptr blob;
+            const PreProcessInfo* preProcess = nullptr;
+            _heteroInferRequest->GetBlob(input._name.c_str(), blob);
+            _heteroInferRequest->GetPreProcess(input._name.c_str(), &preProcess);
+            request.SetBlob(input._name, blob, *preProcess);
+        } else {
+            // the producer slot is not released until this stage completes
+            auto producerSlot = _pipelineSlots[input._producer];
+            IE_ASSERT(nullptr != producerSlot);
+            request.SetBlob(input._name, producerSlot->_request->GetBlob(input._producerName));
+        }
+    }
+    for (auto&& output : _pipelineStages[stage]->_networkOutputs) {
+        Blob::Ptr blob;
+        _heteroInferRequest->GetBlob(output.c_str(), blob);
+        request.SetBlob(output, blob);
+    }
+}
+
+void HeteroAsyncInferRequest::CompletePipelineStage(std::size_t stage) {
+    auto status = _pipelineSlots[stage]->_status;
+    auto exception = std::move(_pipelineException);
+    _pipelineException = nullptr;
+    const bool failed = (StatusCode::OK != status) || (nullptr != exception);
+    // the slots are released as soon as their outputs were read by the last consumer
+    for (std::size_t producer = 0; producer <= stage; ++producer) {
+        auto& slot = _pipelineSlots[producer];
+        if ((nullptr != slot) && (failed || _pipelineStages[producer]->_lastConsumer <= stage)) {
+            _pipelineStages[producer]->Release(slot);
+            slot = nullptr;
+        }
+    }
+    if (nullptr != exception) {
+        std::rethrow_exception(exception);
+    }
+    if (StatusCode::OK != status) {
+        THROW_IE_EXCEPTION << InferenceEngine::details::as_status << status;
+    }
+}
+
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
-    _heteroInferRequest->updateInOutIfNeeded();
+    if (_pipelineStages.empty()) {
+        _heteroInferRequest->updateInOutIfNeeded();
+    }
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    if (_pipelineStages.empty()) {
+        AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    } else {
+        InferUsingAsync();
+    }
+}
+
+void HeteroAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    if (_pipelineStages.empty()) {
+        AsyncInferRequestThreadSafeDefault::GetPerformanceCounts_ThreadUnsafe(perfMap);
+        return;
+    }
+    // subgraph requests are shared, so only the occupancy of the pipeline stages is reported:
+    // the time since the first inference and the part of it when the stage was inferring
+    perfMap.clear();
+    for (std::size_t stage = 0; stage < _pipelineStages.size(); ++stage) {
+        long long elapsed = 0, busy = 0;
+        _pipelineStages[stage]->GetOccupancy(elapsed, busy);
+        InferenceEngineProfileInfo info = {};
+        info.status = InferenceEngineProfileInfo::EXECUTED;
+        info.realTime_uSec = elapsed;
+        info.cpu_uSec = busy;
+        info.execution_index = static_cast<unsigned>(stage);
+        _pipelineStages[stage]->_device.copy(info.exec_type, sizeof(info.exec_type) - 1);
+        std::string("PipelineStage").copy(info.layer_type, sizeof(info.layer_type) - 1);
+        perfMap[std::string("subgraph") + std::to_string(stage) + ": pipeline_stage_occupancy"] = info;
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
@@ -9,10 +9,13 @@
 
 #pragma once
 
+#include <map>
+#include <string>
 #include <vector>
 #include <memory>
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "hetero_infer_request.hpp"
+#include "hetero_pipeline_stage.hpp"
 
 namespace HeteroPlugin {
 
@@ -21,14 +24,26 @@ public:
     using Ptr = std::shared_ptr<HeteroAsyncInferRequest>;
     HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&              request,
                             const InferenceEngine::ITaskExecutor::Ptr&  taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor,
+                            const std::vector<HeteroPipelineStage::Ptr>& pipelineStages = {});
     ~HeteroAsyncInferRequest() override;
     void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+    void GetPerformanceCounts_ThreadUnsafe(
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
+    void RunPipelineStage(std::size_t stage, InferenceEngine::Task task);
+    void SetPipelineStageBlobs(std::size_t stage, HeteroPipelineStage::Slot* slot);
+    void CompletePipelineStage(std::size_t stage);
+
     HeteroInferRequest::Ptr                     _heteroInferRequest;
     std::vector<InferenceEngine::StatusCode>    _statusCodes;
+    std::vector<HeteroPipelineStage::Ptr>       _pipelineStages;
+    // slots of the pipeline stages held by this request, guarded by the pipeline order
+    std::vector<HeteroPipelineStage::Slot*>     _pipelineSlots;
+    std::exception_ptr                          _pipelineException;
 };
 
 }  // namespace HeteroPlugin
@@ -7,6 +7,7 @@
 #include "hetero_async_infer_request.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include "hetero_graph_splitter.hpp"
+#include "hetero_partitioner.hpp"
 #include "hetero_itt.hpp"
 #include "xml_parse_utils.h"
 #include <caseless.hpp>
@@ -380,10 +381,27 @@ void HeteroExecutableNetwork::InitNgraph(const InferenceEngine::ICNNNetwork& net
 
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
-        if (it != _config.end()) {
+        if (it == _config.end()) {
+            THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
+        }
+        auto itPolicy = _config.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+        auto policy = itPolicy != _config.end() ? itPolicy->second : std::string{HETERO_FIRST_SUPPORTED};
+        if (policy == HETERO_MIN_LATENCY) {
+            std::vector<std::string> fallbackDevices;
+            auto deviceQueryResults = _heteroPlugin->QueryDevices(network_, _config, fallbackDevices);
+            HeteroPartitioner partitioner{_config, fallbackDevices};
+            queryNetworkResult.supportedLayersMap = partitioner.Partition(function, deviceQueryResults);
+            if (dumpDotFile) {
+                QueryNetworkResult firstSupported;
+                _heteroPlugin->QueryNetwork(network_, _config, firstSupported);
+                std::ofstream ofstream{"hetero_partition_" + _name + ".txt"};
+                partitioner.Dump(function, queryNetworkResult.supportedLayersMap, HETERO_MIN_LATENCY, ofstream);
+                partitioner.Dump(function, firstSupported.supportedLayersMap, HETERO_FIRST_SUPPORTED, ofstream);
+            }
+        } else if (policy == HETERO_FIRST_SUPPORTED) {
             _heteroPlugin->QueryNetwork(network_, _config, queryNetworkResult);
         } else {
-            THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
+            THROW_IE_EXCEPTION << "Unsupported " << HETERO_CONFIG_KEY(PARTITIONING_POLICY) << " value: " << policy;
         }
     }
 
@@ -926,11 +944,53 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
                                                 _blobNameMap);
 }
 
+std::vector<HeteroPipelineStage::Ptr> HeteroExecutableNetwork::GetPipelineStages() {
+    auto itPipelined = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+    if (itPipelined == _config.end() || itPipelined->second != YES || networks.size() < 2) {
+        return {};
+    }
+    std::call_once(_pipelineStagesOnce, [&] {
+        std::unordered_map<std::string, std::size_t> producers;
+        for (std::size_t i = 0; i < networks.size(); ++i) {
+            for (auto&& outputInfo : networks[i]._network.GetOutputsInfo()) {
+                producers.emplace(outputInfo.first, i);
+            }
+        }
+        // two requests per subgraph: one is inferring while the next stage reads the other one
+        for (std::size_t i = 0; i < networks.size(); ++i) {
+            auto stage = std::make_shared<HeteroPipelineStage>(networks[i]._network, networks[i]._device, 2);
+            stage->_lastConsumer = i;
+            for (auto&& inputInfo : networks[i]._network.GetInputsInfo()) {
+                HeteroPipelineStage::Input input;
+                input._name = inputInfo.first;
+                auto itName = _blobNameMap.find(inputInfo.first);
+                auto producerName = itName != _blobNameMap.end() ? itName->second : inputInfo.first;
+                auto itProducer = producers.find(producerName);
+                if (itProducer != producers.end() && itProducer->second < i) {
+                    input._producer = static_cast<int>(itProducer->second);
+                    input._producerName = producerName;
+                    auto& producer = _pipelineStages[itProducer->second];
+                    producer->_lastConsumer = std::max(producer->_lastConsumer, i);
+                }
+                stage->_inputs.push_back(input);
+            }
+            for (auto&& outputInfo : networks[i]._network.GetOutputsInfo()) {
+                if (contains(_networkOutputs, outputInfo.first)) {
+                    stage->_networkOutputs.push_back(outputInfo.first);
+                }
+            }
+            _pipelineStages.push_back(stage);
+        }
+    });
+    return _pipelineStages;
+}
+
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
     auto heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(
             CreateInferRequestImpl(_networkInputs, _networkOutputs));
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, _taskExecutor, _callbackExecutor);
+    auto asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, _taskExecutor, _callbackExecutor,
+                                                                         GetPipelineStages());
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncThreadSafeImpl),
                        [](IInferRequest *p) { p->Release(); });
     asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
@@ -944,6 +1004,9 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        auto it = _config.find(name);
+        result = it != _config.end() && it->second == YES;
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
@@ -1032,6 +1095,7 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -14,6 +14,7 @@
 #include <map>
 #include <unordered_map>
 #include <unordered_set>
+#include <mutex>
 
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
@@ -22,6 +23,7 @@
 #include "ie_icore.hpp"
 #include <legacy/cnn_network_impl.hpp>
 #include "hetero_async_infer_request.hpp"
+#include "hetero_pipeline_stage.hpp"
 
 namespace HeteroPlugin {
 
@@ -66,6 +68,8 @@ private:
 
     void InitNgraph(const InferenceEngine::ICNNNetwork&     network);
 
+    std::vector<HeteroPipelineStage::Ptr> GetPipelineStages();
+
     struct NetworkDesc {
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
@@ -77,6 +81,8 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::once_flag                          _pipelineStagesOnce;
+    std::vector<HeteroPipelineStage::Ptr>   _pipelineStages;
 };
 
 }  // namespace HeteroPlugin
@@ -0,0 +1,327 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioner.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <details/ie_exception.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+double toCost(const std::map<std::string, std::string>& config, const std::string& key, double defaultValue) {
+    auto it = config.find(key);
+    if (it == config.end() || it->second.empty()) {
+        return defaultValue;
+    }
+    try {
+        auto value = std::stod(it->second);
+        if (value >= 0) {
+            return value;
+        }
+    } catch (...) {}
+    THROW_IE_EXCEPTION << "Wrong value " << it->second << " for property key " << key
+                       << ". Expected non-negative number";
+}
+
+std::size_t tensorBytes(const ngraph::Output<ngraph::Node>& output) {
+    if (output.get_partial_shape().is_dynamic()) {
+        return 0;
+    }
+    return output.get_element_type().size() * ngraph::shape_size(output.get_shape());
+}
+
+bool isPartitioned(const std::shared_ptr<ngraph::Node>& node) {
+    return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+}
+
+}  // namespace
+
+HeteroPartitioner::HeteroPartitioner(const std::map<std::string, std::string>& config,
+                                     const std::vector<std::string>& devices) :
+    _devices{devices},
+    _transferCost{toCost(config, HETERO_CONFIG_KEY(TRANSFER_COST), 100.0)},
+    _subgraphCost{toCost(config, HETERO_CONFIG_KEY(SUBGRAPH_COST), 50.0)},
+    _maxSubgraphs{static_cast<std::size_t>(toCost(config, HETERO_CONFIG_KEY(MAX_SUBGRAPHS), 0.0))} {
+    auto itTable = config.find(HETERO_CONFIG_KEY(COST_TABLE));
+    if (itTable != config.end() && !itTable->second.empty()) {
+        std::ifstream table(itTable->second);
+        if (!table.is_open()) {
+            THROW_IE_EXCEPTION << "Cannot open the cost table " << itTable->second;
+        }
+        std::string line;
+        for (std::size_t lineNumber = 1; std::getline(table, line); ++lineNumber) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream stream(line);
+            std::string device, layer;
+            double cost = 0;
+            if (!(stream >> device >> layer >> cost) || cost < 0) {
+                THROW_IE_EXCEPTION << "Wrong line " << lineNumber << " of the cost table " << itTable->second
+                                   << ". Expected `<device> <layer name or type> <microseconds>`";
+            }
+            _costTable[device + " " + layer] = cost;
+        }
+    }
+}
+
+double HeteroPartitioner::LayerCost(const std::shared_ptr<ngraph::Node>& node, const std::string& device) const {
+    // the device with ID falls back to the costs of the device
+    for (auto&& deviceName : {device, device.substr(0, device.find('.'))}) {
+        for (auto&& layer : {node->get_friendly_name(), std::string{node->get_type_name()}}) {
+            auto itCost = _costTable.find(deviceName + " " + layer);
+            if (itCost != _costTable.end()) {
+                return itCost->second;
+            }
+        }
+    }
+    // about a nanosecond per output element
+    std::size_t elements = 0;
+    for (auto&& output : node->outputs()) {
+        if (output.get_partial_shape().is_static()) {
+            elements += ngraph::shape_size(output.get_shape());
+        }
+    }
+    return 1e-3 * elements;
+}
+
+double HeteroPartitioner::TransferCost(std::size_t bytes) const {
+    return _transferCost * bytes / (1024.0 * 1024.0);
+}
+
+std::vector<HeteroPartitioner::Layer> HeteroPartitioner::Order(
+        const std::shared_ptr<const ngraph::Function>& function,
+        const std::map<std::string, QueryNetworkResult>* supported,
+        std::size_t& numTensors) const {
+    std::vector<Layer> layers;
+    std::unordered_map<ngraph::Node*, std::size_t> positions;
+    std::map<std::pair<ngraph::Node*, std::size_t>, std::size_t> tensors;
+    for (auto&& node : function->get_ordered_ops()) {
+        if (!isPartitioned(node)) {
+            continue;
+        }
+        Layer layer;
+        layer._node = node;
+        bool isSupported = false;
+        for (auto&& device : _devices) {
+            bool isDeviceSupported = true;
+            if (nullptr != supported) {
+                auto itDevice = supported->find(device);
+                isDeviceSupported = itDevice != supported->end() &&
+                    itDevice->second.supportedLayersMap.count(node->get_friendly_name()) != 0;
+            }
+            layer._costs.push_back(isDeviceSupported ? LayerCost(node, device) : -1.0);
+            isSupported = isSupported || isDeviceSupported;
+        }
+        // the layers which are not supported at all are reported later
+        if (!isSupported) {
+            continue;
+        }
+        for (auto&& input : node->inputs()) {
+            auto source = input.get_source_output();
+            auto itProducer = positions.find(source.get_node());
+            if (itProducer == positions.end()) {
+                continue;
+            }
+            auto itTensor = tensors.emplace(std::make_pair(source.get_node(), source.get_index()), tensors.size()).first;
+            layer._inputs.push_back(Tensor{itProducer->second, itTensor->second, tensorBytes(source)});
+        }
+        positions.emplace(node.get(), layers.size());
+        layers.push_back(std::move(layer));
+    }
+    numTensors = tensors.size();
+    return layers;
+}
+
+HeteroPartitioner::Affinities HeteroPartitioner::Partition(const std::shared_ptr<const ngraph::Function>& function,
+                                                           const std::map<std::string, QueryNetworkResult>& supported) {
+    std::size_t numTensors = 0;
+    const auto layers = Order(function, &supported, numTensors);
+    const std::size_t N = layers.size();
+    const std::size_t D = _devices.size();
+    if (N == 0 || D == 0) {
+        return {};
+    }
+    // without the limit all the segment counts share the same state
+    const bool limited = _maxSubgraphs > 0;
+    const std::size_t S = limited ? std::min(_maxSubgraphs, N) : 1;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    struct State {
+        double      _cost;
+        std::size_t _begin;     //!< the first layer of the last segment
+        std::size_t _previous;  //!< segments count index and device of the previous segment
+        std::size_t _previousDevice;
+    };
+    // best cut of the first `end + 1` layers with `s + 1` segments, the last one is on device `d`
+    std::vector<State> states(N * S * D, State{infinity, 0, 0, 0});
+    auto state = [&] (std::size_t end, std::size_t s, std::size_t d) -> State& {
+        return states[(end * S + s) * D + d];
+    };
+
+    std::vector<std::size_t> stamps(numTensors, std::numeric_limits<std::size_t>::max());
+    std::vector<double> compute(D);
+    for (std::size_t begin = 0; begin < N; ++begin) {
+        if (begin > 0 && std::all_of(&state(begin - 1, 0, 0), &state(begin - 1, 0, 0) + S * D,
+                                     [&] (const State& previous) { return previous._cost == infinity; })) {
+            continue;
+        }
+        std::fill(compute.begin(), compute.end(), 0.0);
+        double transfer = 0.0;
+        for (std::size_t end = begin; end < N; ++end) {
+            bool anySupported = false;
+            for (std::size_t d = 0; d < D; ++d) {
+                const double cost = layers[end]._costs[d];
+                compute[d] = (cost < 0 || compute[d] == infinity) ? infinity : compute[d] + cost;
+                anySupported = anySupported || compute[d] != infinity;
+            }
+            if (!anySupported) {
+                break;
+            }
+            // tensors entering the segment are transferred once
+            for (auto&& input : layers[end]._inputs) {
+                if (input._producer < begin && stamps[input._id] != begin) {
+                    stamps[input._id] = begin;
+                    transfer += TransferCost(input._bytes);
+                }
+            }
+            for (std::size_t d = 0; d < D; ++d) {
+                if (compute[d] == infinity) {
+                    continue;
+                }
+                const double segmentCost = compute[d] + transfer + _subgraphCost;
+                if (begin == 0) {
+                    auto& current = state(end, 0, d);
+                    if (segmentCost < current._cost) {
+                        current = State{segmentCost, begin, 0, 0};
+                    }
+                    continue;
+                }
+                for (std::size_t previous = 0; previous < S; ++previous) {
+                    const std::size_t s = limited ? previous + 1 : previous;
+                    if (s >= S) {
+                        continue;
+                    }
+                    auto& current = state(end, s, d);
+                    for (std::size_t previousDevice = 0; previousDevice < D; ++previousDevice) {
+                        // the adjacent segments on the same device are a single segment
+                        if (previousDevice == d) {
+                            continue;
+                        }
+                        const double cost = state(begin - 1, previous, previousDevice)._cost + segmentCost;
+                        if (cost < current._cost) {
+                            current = State{cost, begin, previous, previousDevice};
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::size_t bestS = 0, bestD = 0;
+    for (std::size_t s = 0; s < S; ++s) {
+        for (std::size_t d = 0; d < D; ++d) {
+            if (state(N - 1, s, d)._cost < state(N - 1, bestS, bestD)._cost) {
+                bestS = s;
+                bestD = d;
+            }
+        }
+    }
+    if (state(N - 1, bestS, bestD)._cost == infinity) {
+        THROW_IE_EXCEPTION << "Network " << function->get_friendly_name() << " cannot be cut into "
+                           << _maxSubgraphs << " subgraphs supported by the devices";
+    }
+
+    Affinities affinities;
+    std::size_t end = N - 1, s = bestS, d = bestD;
+    while (true) {
+        const auto& current = state(end, s, d);
+        for (std::size_t i = current._begin; i <= end; ++i) {
+            affinities[layers[i]._node->get_friendly_name()] = _devices[d];
+        }
+        if (current._begin == 0) {
+            break;
+        }
+        end = current._begin - 1;
+        s = current._previous;
+        d = current._previousDevice;
+    }
+    return affinities;
+}
+
+double HeteroPartitioner::Estimate(const std::shared_ptr<const ngraph::Function>& function,
+                                   const Affinities& affinities) const {
+    std::size_t numTensors = 0;
+    const auto layers = Order(function, nullptr, numTensors);
+    std::set<std::pair<std::size_t, std::string>> transferred;
+    std::vector<const std::string*> layerDevices(layers.size(), nullptr);
+    const std::string* previousDevice = nullptr;
+    double cost = 0.0;
+    for (std::size_t i = 0; i < layers.size(); ++i) {
+        auto itAffinity = affinities.find(layers[i]._node->get_friendly_name());
+        if (itAffinity == affinities.end()) {
+            continue;
+        }
+        const auto& device = itAffinity->second;
+        layerDevices[i] = &device;
+        cost += LayerCost(layers[i]._node, device);
+        if (nullptr == previousDevice || *previousDevice != device) {
+            cost += _subgraphCost;
+        }
+        previousDevice = &device;
+        for (auto&& input : layers[i]._inputs) {
+            const auto producerDevice = layerDevices[input._producer];
+            if (nullptr != producerDevice && *producerDevice != device &&
+                transferred.emplace(input._id, device).second) {
+                cost += TransferCost(input._bytes);
+            }
+        }
+    }
+    return cost;
+}
+
+void HeteroPartitioner::Dump(const std::shared_ptr<const ngraph::Function>& function, const Affinities& affinities,
+                             const std::string& title, std::ostream& stream) const {
+    std::size_t numTensors = 0;
+    const auto layers = Order(function, nullptr, numTensors);
+    stream << title << ": estimated latency " << Estimate(function, affinities) << " us" << std::endl;
+    std::size_t segment = 0;
+    for (std::size_t begin = 0; begin < layers.size();) {
+        auto device = [&] (std::size_t i) {
+            auto itAffinity = affinities.find(layers[i]._node->get_friendly_name());
+            return itAffinity == affinities.end() ? std::string{} : itAffinity->second;
+        };
+        std::size_t end = begin;
+        double compute = 0.0;
+        std::size_t transferBytes = 0;
+        std::set<std::size_t> transferred;
+        while (end < layers.size() && device(end) == device(begin)) {
+            compute += LayerCost(layers[end]._node, device(begin));
+            for (auto&& input : layers[end]._inputs) {
+                if (input._producer < begin && transferred.insert(input._id).second) {
+                    transferBytes += input._bytes;
+                }
+            }
+            ++end;
+        }
+        stream << "  segment " << segment++ << " on " << device(begin) << ": " << end - begin << " layers "
+               << layers[begin]._node->get_friendly_name() << " .. " << layers[end - 1]._node->get_friendly_name()
+               << ", compute " << compute << " us, input " << transferBytes << " bytes" << std::endl;
+        begin = end;
+    }
+}
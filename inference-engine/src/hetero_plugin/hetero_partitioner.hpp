@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the latency driven assignment of the layers to the devices
+ * @file hetero_partitioner.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ie_common.h>
+#include <ngraph/function.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Cuts the topological order of the network into contiguous segments, every segment is executed on one device.
+ * The estimated latency is the sum of the layer costs on the chosen devices, the costs of the tensors entering
+ * the segments from the other devices and the fixed cost of every segment. The segments are found by
+ * the dynamic programming over the segment ends, so the number of segments can be limited.
+ */
+class HeteroPartitioner {
+public:
+    using Affinities = std::map<std::string, std::string>;
+
+    HeteroPartitioner(const std::map<std::string, std::string>& config, const std::vector<std::string>& devices);
+
+    /**
+     * @brief Assigns the layers supported by at least one device, other layers are not assigned
+     * @param supported Maps a device to the query result of the device
+     */
+    Affinities Partition(const std::shared_ptr<const ngraph::Function>& function,
+                         const std::map<std::string, InferenceEngine::QueryNetworkResult>& supported);
+
+    /**
+     * @brief Writes the segments of the assignment and its estimated latency
+     */
+    void Dump(const std::shared_ptr<const ngraph::Function>& function, const Affinities& affinities,
+              const std::string& title, std::ostream& stream) const;
+
+    /**
+     * @brief Estimated latency of the assignment in microseconds
+     */
+    double Estimate(const std::shared_ptr<const ngraph::Function>& function, const Affinities& affinities) const;
+
+private:
+    struct Tensor {
+        std::size_t _producer;  //!< position of the producer in the order
+        std::size_t _id;
+        std::size_t _bytes;
+    };
+    struct Layer {
+        std::shared_ptr<ngraph::Node>   _node;
+        std::vector<double>             _costs;     //!< per device, negative if the device does not support the layer
+        std::vector<Tensor>             _inputs;    //!< inputs produced by the other layers of the order
+    };
+
+    std::vector<Layer> Order(const std::shared_ptr<const ngraph::Function>& function,
+                             const std::map<std::string, InferenceEngine::QueryNetworkResult>* supported,
+                             std::size_t& numTensors) const;
+    double LayerCost(const std::shared_ptr<ngraph::Node>& node, const std::string& device) const;
+    double TransferCost(std::size_t bytes) const;
+
+    std::vector<std::string>                _devices;
+    std::unordered_map<std::string, double> _costTable;  // "<device> <name or type>" -> microseconds
+    double                                  _transferCost = 100.0;
+    double                                  _subgraphCost = 50.0;
+    std::size_t                             _maxSubgraphs = 0;
+};
+
+}  // namespace HeteroPlugin
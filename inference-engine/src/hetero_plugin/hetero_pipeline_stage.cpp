@@ -0,0 +1,104 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_pipeline_stage.hpp"
+
+#include <string>
+#include <utility>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroPipelineStage::HeteroPipelineStage(const ExecutableNetwork& network, const std::string& device, std::size_t numSlots) :
+    _device{device},
+    _network{network},
+    _slots(numSlots) {
+    for (auto&& slot : _slots) {
+        auto slotPtr = &slot;
+        slot._request = _network.CreateInferRequestPtr();
+        slot._request->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+            [this, slotPtr] (InferRequest, StatusCode status) mutable {
+                slotPtr->_status = status;
+                OnCompleted();
+                auto capturedTask = std::move(slotPtr->_task);
+                capturedTask();
+            });
+        _idleSlots.push_back(slotPtr);
+    }
+}
+
+void HeteroPipelineStage::Run(SlotTask task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingTasks.push_back(std::move(task));
+    }
+    Schedule();
+}
+
+void HeteroPipelineStage::Release(Slot* slot) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _idleSlots.push_back(slot);
+    }
+    Schedule();
+}
+
+void HeteroPipelineStage::Schedule() {
+    while (true) {
+        Slot* slot = nullptr;
+        SlotTask task;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_idleSlots.empty() || _pendingTasks.empty()) {
+                return;
+            }
+            slot = _idleSlots.front();
+            _idleSlots.pop_front();
+            task = std::move(_pendingTasks.front());
+            _pendingTasks.pop_front();
+        }
+        task(slot);
+    }
+}
+
+void HeteroPipelineStage::StartAsync(Slot* slot, std::function<void()> task) {
+    slot->_status = StatusCode::OK;
+    slot->_task = std::move(task);
+    OnStarted();
+    try {
+        slot->_request->StartAsync();
+    } catch (...) {
+        OnCompleted();
+        throw;
+    }
+}
+
+void HeteroPipelineStage::OnStarted() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto now = Time::now();
+    if (!_started) {
+        _started = true;
+        _firstStart = now;
+    }
+    if (0 == _inferring++) {
+        _busyStart = now;
+    }
+}
+
+void HeteroPipelineStage::OnCompleted() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (0 == --_inferring) {
+        _busyTime += Time::now() - _busyStart;
+    }
+}
+
+void HeteroPipelineStage::GetOccupancy(long long& elapsed_uSec, long long& busy_uSec) const {
+    using std::chrono::duration_cast;
+    using std::chrono::microseconds;
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto now = Time::now();
+    auto busyTime = _busyTime + (_inferring > 0 ? now - _busyStart : Time::duration::zero());
+    elapsed_uSec = _started ? duration_cast<microseconds>(now - _firstStart).count() : 0;
+    busy_uSec = duration_cast<microseconds>(busyTime).count();
+}
@@ -0,0 +1,96 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the pipelined execution of the subgraphs
+ * @file hetero_pipeline_stage.hpp
+ */
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ie_common.h>
+#include <cpp/ie_infer_request.hpp>
+#include <cpp/ie_executable_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Infer requests of a subgraph shared by all the infer requests of a pipelined executable network.
+ * The stage has two requests, so it processes the next infer request while the following stages read
+ * the outputs of the previous one.
+ */
+class HeteroPipelineStage {
+public:
+    using Ptr = std::shared_ptr<HeteroPipelineStage>;
+    using Time = std::chrono::steady_clock;
+
+    struct Slot {
+        InferenceEngine::InferRequest::Ptr  _request;
+        InferenceEngine::StatusCode         _status = InferenceEngine::StatusCode::OK;
+        std::function<void()>               _task;
+    };
+    using SlotTask = std::function<void(Slot*)>;
+
+    /**
+     * @brief Input of the subgraph: a network input or an output of the previous subgraph `_producer`
+     */
+    struct Input {
+        std::string _name;
+        int         _producer = -1;
+        std::string _producerName;
+    };
+
+    HeteroPipelineStage(const InferenceEngine::ExecutableNetwork& network, const std::string& device, std::size_t numSlots);
+
+    /**
+     * @brief Runs the task with an idle slot, the task waits in the queue while all the slots are busy
+     */
+    void Run(SlotTask task);
+
+    /**
+     * @brief Starts the slot request, `task` is called on the completion
+     */
+    void StartAsync(Slot* slot, std::function<void()> task);
+
+    /**
+     * @brief Returns the slot to the stage once its outputs are not needed anymore
+     */
+    void Release(Slot* slot);
+
+    /**
+     * @brief Returns the time since the first start and the part of it when at least one slot was inferring
+     */
+    void GetOccupancy(long long& elapsed_uSec, long long& busy_uSec) const;
+
+    std::string                 _device;
+    std::vector<Input>          _inputs;
+    std::vector<std::string>    _networkOutputs;
+    std::size_t                 _lastConsumer = 0;  //!< the last stage which reads the outputs of this stage
+
+private:
+    void Schedule();
+    void OnStarted();
+    void OnCompleted();
+
+    InferenceEngine::ExecutableNetwork  _network;
+    std::vector<Slot>                   _slots;
+    mutable std::mutex                  _mutex;
+    std::deque<Slot*>                   _idleSlots;
+    std::deque<SlotTask>                _pendingTasks;
+    unsigned int                        _inferring = 0;
+    bool                                _started = false;
+    Time::time_point                    _firstStart;
+    Time::time_point                    _busyStart;
+    Time::duration                      _busyTime = Time::duration::zero();
+};
+
+}  // namespace HeteroPlugin
@@ -32,6 +32,12 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = NO;
+    _config[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_FIRST_SUPPORTED;
+    _config[HETERO_CONFIG_KEY(COST_TABLE)] = "";
+    _config[HETERO_CONFIG_KEY(TRANSFER_COST)] = "100";
+    _config[HETERO_CONFIG_KEY(SUBGRAPH_COST)] = "50";
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "0";
 }
 
 namespace {
@@ -195,6 +201,22 @@ void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &c
 }
 
 void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, QueryNetworkResult &qr) const {
+    //  WARNING: Here is devices with user set priority
+    std::vector<std::string> fallbackDevices;
+    auto queryResults = QueryDevices(network, config, fallbackDevices);
+
+    for (auto&& deviceName : fallbackDevices) {
+        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+            qr.supportedLayersMap.emplace(layerQueryResult);
+        }
+    }
+
+    // set OK status
+    qr.rc = StatusCode::OK;
+}
+
+std::map<std::string, QueryNetworkResult> Engine::QueryDevices(const ICNNNetwork &network, const Configs& config,
+                                                              std::vector<std::string>& fallbackDevices) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -246,17 +268,8 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
         queryNetwork(network);
     }
 
-    //  WARNING: Here is devices with user set priority
-    auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
-
-    for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
-            qr.supportedLayersMap.emplace(layerQueryResult);
-        }
-    }
-
-    // set OK status
-    qr.rc = StatusCode::OK;
+    fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
+    return queryResults;
 }
 
 Parameter Engine::GetMetric(const std::string& name, const std::map<std::string, Parameter> & /*options*/) const {
@@ -268,6 +281,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINED_EXECUTION),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
+            HETERO_CONFIG_KEY(COST_TABLE),
+            HETERO_CONFIG_KEY(TRANSFER_COST),
+            HETERO_CONFIG_KEY(SUBGRAPH_COST),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -284,6 +303,19 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINED_EXECUTION)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINED_EXECUTION));
+        IE_ASSERT(it != _config.end());
+        bool pipelined = it->second == YES;
+        return { pipelined };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY) ||
+               name == HETERO_CONFIG_KEY(COST_TABLE) ||
+               name == HETERO_CONFIG_KEY(TRANSFER_COST) ||
+               name == HETERO_CONFIG_KEY(SUBGRAPH_COST) ||
+               name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
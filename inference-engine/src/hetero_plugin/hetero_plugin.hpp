@@ -43,6 +43,13 @@ public:
 
     void SetAffinity(InferenceEngine::ICNNNetwork& network, const Configs &config);
 
+    /**
+     * @brief Queries every device of TARGET_FALLBACK, the devices are returned in the priority order
+     */
+    std::map<std::string, InferenceEngine::QueryNetworkResult> QueryDevices(const InferenceEngine::ICNNNetwork &network,
+                                                                            const Configs& config,
+                                                                            std::vector<std::string>& devices) const;
+
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
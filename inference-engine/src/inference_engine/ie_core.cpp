@@ -2,8 +2,17 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <list>
 #include <map>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 #include <istream>
@@ -17,8 +26,11 @@
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_itt.hpp"
+#include "ie_tracer.hpp"
+#include "cnn_network_ngraph_impl.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
+#include "ie_network_hash.hpp"
 #include "xml_parse_utils.h"
 
 using namespace InferenceEngine::PluginConfigParams;
@@ -170,7 +182,231 @@ class Core::Impl : public ICore {
     std::vector<IExtensionPtr> extensions;
 
     std::map<std::string, PluginDescriptor> pluginRegistry;
-    mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
+    // device name -> values of the keys handled by Core, empty device name is for all devices
+    std::map<std::string, std::map<std::string, std::string>> coreConfigs;
+    mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry, plugins and coreConfigs
+
+    struct NetworkCacheEntry {
+        std::string key;
+        std::weak_ptr<const ngraph::Function> function;
+        ExecutableNetwork network;
+    };
+    struct NetworkCacheStats {
+        unsigned int hits = 0;
+        unsigned int misses = 0;
+        float compileTime = 0.f;  // milliseconds
+    };
+    // device name -> executable networks, the most recently used network is the first one
+    std::map<std::string, std::list<NetworkCacheEntry>> networkCaches;
+    std::map<std::string, NetworkCacheStats> networkCacheStats;
+    mutable std::mutex networkCacheMutex;  // to lock parallel access to networkCaches and networkCacheStats
+
+    using ShapeBuckets = std::map<std::string, std::map<size_t, std::vector<size_t>>>;  // input -> axis -> sizes
+
+    /**
+     * @brief Parses a non negative number of the config value, the whole string must be the number
+     */
+    static size_t ParseSize(const std::string& number, const std::string& key, const std::string& value) {
+        try {
+            if (number.empty() || !std::isdigit(static_cast<unsigned char>(number.front()))) {
+                throw std::invalid_argument(number);
+            }
+            size_t pos = 0;
+            auto size = std::stoull(number, &pos);
+            if (pos != number.size()) {
+                throw std::invalid_argument(number);
+            }
+            if (size > std::numeric_limits<size_t>::max()) {
+                throw std::out_of_range(number);
+            }
+            return static_cast<size_t>(size);
+        } catch (std::invalid_argument&) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for " << key << ", " << number
+                               << " is not a non negative number";
+        } catch (std::out_of_range&) {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for " << key << ", " << number << " is out of range";
+        }
+    }
+
+    static ShapeBuckets ParseShapeBuckets(const std::string& value) {
+        ShapeBuckets buckets;
+        std::stringstream entries(value);
+        for (std::string entry; std::getline(entries, entry, ';');) {
+            if (entry.empty()) {
+                continue;
+            }
+            auto sizesPos = entry.rfind(':');
+            auto axisPos = sizesPos == std::string::npos || sizesPos == 0 ? std::string::npos : entry.rfind(':', sizesPos - 1);
+            if (axisPos == std::string::npos || axisPos == 0) {
+                THROW_IE_EXCEPTION << "Wrong value " << entry << " for " << CONFIG_KEY(SHAPE_BUCKETS)
+                                   << ", <input name>:<axis>:<size>,<size>,... is expected";
+            }
+            auto axis = ParseSize(entry.substr(axisPos + 1, sizesPos - axisPos - 1), CONFIG_KEY(SHAPE_BUCKETS), entry);
+            auto& sizes = buckets[entry.substr(0, axisPos)][axis];
+            std::stringstream sizesStream(entry.substr(sizesPos + 1));
+            for (std::string size; std::getline(sizesStream, size, ',');) {
+                sizes.push_back(ParseSize(size, CONFIG_KEY(SHAPE_BUCKETS), entry));
+            }
+            if (sizes.empty()) {
+                THROW_IE_EXCEPTION << "Wrong value " << entry << " for " << CONFIG_KEY(SHAPE_BUCKETS) << ", no sizes are set";
+            }
+            std::sort(sizes.begin(), sizes.end());
+        }
+        return buckets;
+    }
+
+    static size_t ParseNetworkCacheSize(const std::string& value) {
+        if (value.empty()) {
+            return 0;
+        }
+        return ParseSize(value, CONFIG_KEY(NETWORK_CACHE_SIZE), value);
+    }
+
+    /**
+     * @brief Returns shapes of the inputs padded up to the shape buckets, unchanged inputs are not returned
+     */
+    static ICNNNetwork::InputShapes GetBucketedShapes(const CNNNetwork& network, const ShapeBuckets& buckets) {
+        ICNNNetwork::InputShapes shapes;
+        for (auto&& input : network.getInputsInfo()) {
+            auto inputBuckets = buckets.find(input.first);
+            if (buckets.end() == inputBuckets) {
+                continue;
+            }
+            auto dims = input.second->getTensorDesc().getDims();
+            bool changed = false;
+            for (auto&& axisBuckets : inputBuckets->second) {
+                if (axisBuckets.first >= dims.size()) {
+                    continue;
+                }
+                auto& dim = dims[axisBuckets.first];
+                auto size = std::lower_bound(axisBuckets.second.begin(), axisBuckets.second.end(), dim);
+                if (axisBuckets.second.end() != size && *size != dim) {
+                    dim = *size;
+                    changed = true;
+                }
+            }
+            if (changed) {
+                shapes[input.first] = dims;
+            }
+        }
+        return shapes;
+    }
+
+    /**
+     * @brief Describes everything but the topology and weights which affects an executable network
+     */
+    static std::string CalculateNetworkCacheKey(const CNNNetwork& network, const ICNNNetwork::InputShapes& shapes,
+                                                const std::map<std::string, std::string>& config) {
+        std::stringstream key;
+        for (auto&& option : config) {
+            key << option.first << '=' << option.second << ';';
+        }
+        for (auto&& input : network.getInputsInfo()) {
+            auto shape = shapes.find(input.first);
+            const auto& desc = input.second->getTensorDesc();
+            key << "\ninput " << input.first << ' ' << desc.getPrecision() << ' ' << desc.getLayout();
+            for (auto dim : shapes.end() == shape ? desc.getDims() : shape->second) {
+                key << ' ' << dim;
+            }
+        }
+        for (auto&& output : network.getOutputsInfo()) {
+            key << "\noutput " << output.first << ' ' << output.second->getPrecision() << ' ' << output.second->getLayout();
+        }
+        return key.str();
+    }
+
+    bool DeviceSupportsImportExport(const InferencePlugin& plugin) const {
+        std::vector<std::string> supportedMetricKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        auto it = std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        return supportedMetricKeys.end() != it && plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+    }
+
+    std::string CalculateNetworkHash(const InferencePlugin& plugin, const CNNNetwork& network,
+                                     const std::string& deviceName, const std::map<std::string, std::string>& config) const {
+        std::map<std::string, std::string> compileOptions;
+        auto version = plugin.GetVersion();
+        compileOptions["DEVICE"] = deviceName;
+        compileOptions["PLUGIN_VERSION"] = std::string(version.description) + " " + version.buildNumber;
+
+        // device capabilities define the instruction set and kernels chosen during compilation
+        std::vector<std::string> supportedMetricKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+        for (auto&& metricName : {METRIC_KEY(FULL_DEVICE_NAME), METRIC_KEY(OPTIMIZATION_CAPABILITIES)}) {
+            if (std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), metricName) != supportedMetricKeys.end()) {
+                auto metric = plugin.GetMetric(metricName, {});
+                if (metric.is<std::string>()) {
+                    compileOptions[metricName] = metric.as<std::string>();
+                } else if (metric.is<std::vector<std::string>>()) {
+                    for (auto&& value : metric.as<std::vector<std::string>>()) {
+                        compileOptions[metricName] += value + " ";
+                    }
+                }
+            }
+        }
+
+        // effective configuration is a plugin configuration overridden by LoadNetwork one
+        if (std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(), METRIC_KEY(SUPPORTED_CONFIG_KEYS)) != supportedMetricKeys.end()) {
+            std::vector<std::string> configKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), {});
+            for (auto&& key : configKeys) {
+                try {
+                    auto value = plugin.GetConfig(key, {});
+                    if (value.is<std::string>()) {
+                        compileOptions["CONFIG_" + key] = value.as<std::string>();
+                    }
+                } catch (const std::exception&) {
+                    // some keys are write only
+                }
+            }
+        }
+        for (auto&& option : config) {
+            compileOptions["CONFIG_" + option.first] = option.second;
+        }
+
+        return details::computeNetworkHash(network, compileOptions);
+    }
+
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network, const std::string& deviceName,
+                                           const std::map<std::string, std::string>& config, const std::string& cacheDir) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache");
+        std::string networkHash;
+        try {
+            networkHash = CalculateNetworkHash(plugin, network, deviceName, config);
+        } catch (const details::InferenceEngineException&) {
+            // the network has attributes which cannot be hashed, so it is not cached
+            return plugin.LoadNetwork(network, config);
+        }
+        auto blobFileName = FileUtils::makePath(cacheDir, networkHash + ".blob");
+
+        if (FileUtils::fileExist(blobFileName)) {
+            try {
+                std::ifstream networkStream(blobFileName, std::ios::binary);
+                return plugin.ImportNetwork(networkStream, config);
+            } catch (const std::exception&) {
+                // cached network is broken or incompatible, so it is compiled and stored again
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(network, config);
+
+        // the network is written to a temporary file first not to expose incomplete cache entries
+        auto tmpFileName = blobFileName + ".tmp";
+        try {
+            {
+                std::ofstream networkStream(tmpFileName, std::ios::binary);
+                if (!networkStream.is_open()) {
+                    THROW_IE_EXCEPTION << "Cannot open " << tmpFileName;
+                }
+                executableNetwork.Export(networkStream);
+            }
+            std::remove(blobFileName.c_str());
+            if (0 != std::rename(tmpFileName.c_str(), blobFileName.c_str())) {
+                std::remove(tmpFileName.c_str());
+            }
+        } catch (const std::exception&) {
+            // caching is an optimization, so failures are not propagated to the user
+            std::remove(tmpFileName.c_str());
+        }
+        return executableNetwork;
+    }
 
 public:
     Impl();
@@ -268,7 +504,75 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+
+        // keys handled by Core are not passed to plugins, LoadNetwork values override SetConfig ones
+        std::map<std::string, std::string> coreConfig;
+        for (auto&& key : {CONFIG_KEY(CACHE_DIR), CONFIG_KEY(NETWORK_CACHE_SIZE), CONFIG_KEY(SHAPE_BUCKETS)}) {
+            auto value = parsed._config.find(key);
+            if (parsed._config.end() != value) {
+                coreConfig[key] = value->second;
+                parsed._config.erase(value);
+            } else {
+                coreConfig[key] = GetCoreConfig(parsed._deviceName, key);
+            }
+        }
+
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        auto function = network.getFunction();
+        // legacy networks cannot be copied and reshaped here and have no function to identify them
+        auto shapes = function ? GetBucketedShapes(network, ParseShapeBuckets(coreConfig[CONFIG_KEY(SHAPE_BUCKETS)]))
+                               : ICNNNetwork::InputShapes{};
+        auto compile = [&] {
+            CNNNetwork actualNetwork = network;
+            if (!shapes.empty()) {
+                actualNetwork = CNNNetwork(std::make_shared<details::CNNNetworkNGraphImpl>(network));
+                actualNetwork.reshape(shapes);
+            }
+            const auto& cacheDir = coreConfig[CONFIG_KEY(CACHE_DIR)];
+            if (!cacheDir.empty() && DeviceSupportsImportExport(plugin)) {
+                return LoadNetworkWithCache(plugin, actualNetwork, parsed._deviceName, parsed._config, cacheDir);
+            }
+            return plugin.LoadNetwork(actualNetwork, parsed._config);
+        };
+
+        auto cacheSize = ParseNetworkCacheSize(coreConfig[CONFIG_KEY(NETWORK_CACHE_SIZE)]);
+        if (0 == cacheSize || !function) {
+            return compile();
+        }
+
+        auto key = CalculateNetworkCacheKey(network, shapes, parsed._config);
+        auto isCached = [&] (const NetworkCacheEntry& entry) {
+            return entry.key == key && entry.function.lock() == function;
+        };
+        {
+            std::lock_guard<std::mutex> lock(networkCacheMutex);
+            auto& cache = networkCaches[parsed._deviceName];
+            auto entry = std::find_if(cache.begin(), cache.end(), isCached);
+            if (cache.end() != entry) {
+                cache.splice(cache.begin(), cache, entry);
+                networkCacheStats[parsed._deviceName].hits++;
+                return cache.front().network;
+            }
+        }
+
+        // the network is compiled without the lock, so parallel calls for other shapes are not blocked
+        auto start = std::chrono::steady_clock::now();
+        auto executableNetwork = compile();
+        std::chrono::duration<float, std::milli> compileTime = std::chrono::steady_clock::now() - start;
+
+        std::lock_guard<std::mutex> lock(networkCacheMutex);
+        auto& stats = networkCacheStats[parsed._deviceName];
+        stats.misses++;
+        stats.compileTime += compileTime.count();
+        auto& cache = networkCaches[parsed._deviceName];
+        cache.remove_if([&] (const NetworkCacheEntry& entry) {
+            return isCached(entry) || entry.function.expired();
+        });
+        cache.push_front({key, function, executableNetwork});
+        while (cache.size() > cacheSize) {
+            cache.pop_back();
+        }
+        return executableNetwork;
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -318,6 +622,11 @@ public:
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+        if (name == METRIC_KEY(NETWORK_CACHE_HITS) || name == METRIC_KEY(NETWORK_CACHE_MISSES) ||
+            name == METRIC_KEY(NETWORK_CACHE_COMPILE_TIME)) {
+            return GetNetworkCacheMetric(parsed._deviceName, name);
+        }
+
         // we need to return a copy of Parameter object which is created on Core side,
         // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
         // TODO: remove this WA after *-31417 is resolved
@@ -450,6 +759,13 @@ public:
      *        If empty, config is set for all the plugins / plugin's meta-data
      */
     void SetConfigForPlugins(const std::map<std::string, std::string>& config, const std::string& deviceName) {
+        if (!config.empty()) {
+            // the cached networks were compiled with the previous plugin configuration, which is not a part of
+            // their keys. HETERO and MULTI networks depend on the configuration of other devices, so all are dropped
+            std::lock_guard<std::mutex> lock(networkCacheMutex);
+            networkCaches.clear();
+        }
+
         std::lock_guard<std::mutex> lock(pluginsMutex);
 
         // set config for plugins in registry
@@ -477,6 +793,76 @@ public:
         }
     }
 
+    /**
+     * @brief Checks whether a configuration key is handled by Core itself and is not passed to plugins
+     */
+    static bool IsCoreConfigKey(const std::string& key) {
+        return key == CONFIG_KEY(CACHE_DIR) || key == CONFIG_KEY(NETWORK_CACHE_SIZE) || key == CONFIG_KEY(SHAPE_BUCKETS) ||
+               key == CONFIG_KEY(TRACE_FILE);
+    }
+
+    /**
+     * @brief Sets a value of a key handled by Core
+     * @param key A key, see IsCoreConfigKey
+     * @param value A value, empty value resets the key to default
+     * @param deviceName A device name to set the value for
+     *        If empty, the value is set for all the devices without own value
+     */
+    void SetCoreConfig(const std::string& key, const std::string& value, const std::string& deviceName) {
+        if (key == CONFIG_KEY(NETWORK_CACHE_SIZE)) {
+            ParseNetworkCacheSize(value);
+        } else if (key == CONFIG_KEY(SHAPE_BUCKETS)) {
+            ParseShapeBuckets(value);
+        } else if (key == CONFIG_KEY(TRACE_FILE)) {
+            // The tracer is process wide, so the value is not bound to a device
+            if (value.empty()) {
+                Tracer::stop();
+            } else {
+                Tracer::start(value);
+            }
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            coreConfigs[std::string()][key] = value;
+            return;
+        }
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        coreConfigs[deviceName][key] = value;
+    }
+
+    /**
+     * @brief Returns a value of a key handled by Core for a device
+     * @param deviceName A device name
+     * @param key A key, see IsCoreConfigKey
+     * @return A value or empty string if the key is not set for the device
+     */
+    std::string GetCoreConfig(const std::string& deviceName, const std::string& key) const {
+        std::lock_guard<std::mutex> lock(pluginsMutex);
+        for (auto&& name : {deviceName, std::string()}) {
+            auto deviceConfig = coreConfigs.find(name);
+            if (coreConfigs.end() != deviceConfig) {
+                auto value = deviceConfig->second.find(key);
+                if (deviceConfig->second.end() != value && !value->second.empty()) {
+                    return value->second;
+                }
+            }
+        }
+        return {};
+    }
+
+    /**
+     * @brief Returns a metric of the in-memory executable network cache of a device
+     */
+    Parameter GetNetworkCacheMetric(const std::string& deviceName, const std::string& name) const {
+        std::lock_guard<std::mutex> lock(networkCacheMutex);
+        auto stats = networkCacheStats.find(deviceName);
+        auto deviceStats = networkCacheStats.end() == stats ? NetworkCacheStats{} : stats->second;
+        if (name == METRIC_KEY(NETWORK_CACHE_HITS)) {
+            return deviceStats.hits;
+        } else if (name == METRIC_KEY(NETWORK_CACHE_MISSES)) {
+            return deviceStats.misses;
+        }
+        return deviceStats.compileTime;
+    }
+
     /**
      * @brief Registers the extension in a Core object
      *        Such extensions can be used for both CNNNetwork readers and device plugins
@@ -516,7 +902,13 @@ Core::Impl::Impl() {
     opsetNames.insert("opset4");
 }
 
-Core::Impl::~Impl() {}
+Core::Impl::~Impl() {
+    if (!GetCoreConfig(std::string(), CONFIG_KEY(TRACE_FILE)).empty()) {
+        try {
+            Tracer::stop();
+        } catch (...) {}
+    }
+}
 
 Core::Core(const std::string& xmlConfigFile) {
     _impl = std::make_shared<Impl>();
@@ -706,10 +1098,20 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // compiled networks caches are handled by Core itself
+    std::map<std::string, std::string> config_;
+    for (auto&& option : config) {
+        if (Impl::IsCoreConfigKey(option.first)) {
+            _impl->SetCoreConfig(option.first, option.second, parseDeviceNameIntoConfig(deviceName)._deviceName);
+        } else {
+            config_.insert(option);
+        }
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(config_, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config_);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
@@ -734,6 +1136,11 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
 
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+    if (Impl::IsCoreConfigKey(name)) {
+        auto value = _impl->GetCoreConfig(parsed._deviceName, name);
+        return value.empty() && name == CONFIG_KEY(NETWORK_CACHE_SIZE) ? std::string("0") : value;
+    }
+
     // we need to return a copy of Parameter object which is created on Core side,
     // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
     // TODO: remove this WA after *-31417 is resolved
@@ -0,0 +1,302 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_network_hash.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/attribute_visitor.hpp>
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+#include <legacy/details/ie_cnn_network_iterator.hpp>
+#include <details/ie_exception.hpp>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+class Hasher {
+public:
+    void combine(std::uint64_t value) {
+        _seed ^= value + 0x9e3779b97f4a7c15ULL + (_seed << 6) + (_seed >> 2);
+    }
+
+    void combine(const void* data, std::size_t size) {
+        // FNV-1a over 64-bit words, tail is processed bytewise
+        auto bytes = static_cast<const std::uint8_t*>(data);
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i, sizeof(word));
+            h = (h ^ word) * 0x100000001b3ULL;
+        }
+        for (; i < size; ++i) {
+            h = (h ^ bytes[i]) * 0x100000001b3ULL;
+        }
+        combine(h);
+        combine(static_cast<std::uint64_t>(size));
+    }
+
+    void combine(const std::string& value) {
+        combine(value.data(), value.size());
+    }
+
+    template <typename T>
+    void combine(const std::vector<T>& values) {
+        combine(static_cast<std::uint64_t>(values.size()));
+        for (auto&& value : values) {
+            combine(static_cast<std::uint64_t>(value));
+        }
+    }
+
+    std::string str() const {
+        std::stringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << _seed;
+        return ss.str();
+    }
+
+private:
+    std::uint64_t _seed = 0;
+};
+
+class HashVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashVisitor(Hasher& hasher) : _hasher(hasher) {}
+
+    // Attributes the hash does not know are not skipped, otherwise networks which differ in them collide
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        THROW_IE_EXCEPTION << "Cannot compute a hash of the attribute " << name << " of "
+                           << adapter.get_type_info().name << " type";
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        _hasher.combine(name);
+        _hasher.combine(adapter.get_ptr(), adapter.size());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        _hasher.combine(name);
+        _hasher.combine(adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        hashInteger(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        hashBytes(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashBytes(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        hashVector(name, adapter);
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        _hasher.combine(name);
+        _hasher.combine(static_cast<std::uint64_t>(adapter.get().size()));
+        for (auto&& value : adapter.get()) {
+            _hasher.combine(value);
+        }
+    }
+
+private:
+    template <typename T>
+    void hashInteger(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        _hasher.combine(name);
+        _hasher.combine(static_cast<std::uint64_t>(adapter.get()));
+    }
+
+    template <typename T>
+    void hashBytes(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        _hasher.combine(name);
+        auto value = adapter.get();
+        _hasher.combine(&value, sizeof(value));
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        _hasher.combine(name);
+        const auto& value = adapter.get();
+        _hasher.combine(value.data(), value.size() * sizeof(T));
+    }
+
+    Hasher& _hasher;
+};
+
+void hashFunction(Hasher& hasher, const std::shared_ptr<ngraph::Function>& function) {
+    HashVisitor visitor{hasher};
+    for (auto&& op : function->get_ordered_ops()) {
+        hasher.combine(std::string(op->get_type_name()));
+        hasher.combine(static_cast<std::uint64_t>(op->get_version()));
+        hasher.combine(op->get_friendly_name());
+        for (auto&& input : op->inputs()) {
+            auto source = input.get_source_output();
+            hasher.combine(source.get_node()->get_friendly_name());
+            hasher.combine(static_cast<std::uint64_t>(source.get_index()));
+        }
+        for (std::size_t i = 0; i < op->get_output_size(); ++i) {
+            hasher.combine(op->get_output_element_type(i).get_type_name());
+            std::stringstream shape;
+            shape << op->get_output_partial_shape(i);
+            hasher.combine(shape.str());
+        }
+        op->visit_attributes(visitor);
+    }
+}
+
+void hashLegacyNetwork(Hasher& hasher, const ICNNNetwork& network) {
+    IE_SUPPRESS_DEPRECATED_START
+    for (CNNNetworkIterator it(&network); it != CNNNetworkIterator(); it++) {
+        auto layer = *it;
+        hasher.combine(layer->type);
+        hasher.combine(layer->name);
+        hasher.combine(std::string(layer->precision.name()));
+        for (auto&& param : layer->params) {
+            hasher.combine(param.first);
+            hasher.combine(param.second);
+        }
+        for (auto&& input : layer->insData) {
+            hasher.combine(input.lock()->getName());
+        }
+        for (auto&& output : layer->outData) {
+            hasher.combine(output->getName());
+            hasher.combine(std::string(output->getPrecision().name()));
+            hasher.combine(output->getDims());
+        }
+        for (auto&& blob : layer->blobs) {
+            hasher.combine(blob.first);
+            if (blob.second) {
+                hasher.combine(blob.second->cbuffer().as<const void*>(), blob.second->byteSize());
+            }
+        }
+    }
+    IE_SUPPRESS_DEPRECATED_END
+}
+
+}  // namespace
+
+std::string computeNetworkHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions) {
+    Hasher hasher;
+
+    if (auto function = network.getFunction()) {
+        hashFunction(hasher, std::const_pointer_cast<ngraph::Function>(function));
+    } else {
+        hashLegacyNetwork(hasher, static_cast<const ICNNNetwork&>(network));
+    }
+
+    for (auto&& input : network.getInputsInfo()) {
+        const auto& preProcess = input.second->getPreProcess();
+        hasher.combine(input.first);
+        hasher.combine(std::string(input.second->getPrecision().name()));
+        hasher.combine(static_cast<std::uint64_t>(input.second->getLayout()));
+        hasher.combine(input.second->getTensorDesc().getDims());
+        hasher.combine(static_cast<std::uint64_t>(preProcess.getResizeAlgorithm()));
+        hasher.combine(static_cast<std::uint64_t>(preProcess.getColorFormat()));
+        hasher.combine(static_cast<std::uint64_t>(preProcess.getMeanVariant()));
+        for (std::size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+            const auto& channel = preProcess[c];
+            hasher.combine(&channel->meanValue, sizeof(channel->meanValue));
+            hasher.combine(&channel->stdScale, sizeof(channel->stdScale));
+            if (channel->meanData) {
+                hasher.combine(channel->meanData->cbuffer().as<const void*>(), channel->meanData->byteSize());
+            }
+        }
+    }
+
+    for (auto&& output : network.getOutputsInfo()) {
+        hasher.combine(output.first);
+        hasher.combine(std::string(output.second->getPrecision().name()));
+        hasher.combine(static_cast<std::uint64_t>(output.second->getLayout()));
+    }
+
+    for (auto&& option : compileOptions) {
+        hasher.combine(option.first);
+        hasher.combine(option.second);
+    }
+
+    return hasher.str();
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,23 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <map>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Computes a hash of network topology, operation attributes, weights and input / output information
+ * @param network A network to compute hash for
+ * @param compileOptions A map of options which affect compilation (device, configuration, ISA, etc.)
+ * @return A hexadecimal string which can be used as a file name
+ */
+std::string computeNetworkHash(const CNNNetwork& network, const std::map<std::string, std::string>& compileOptions);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "mmap_allocator.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -34,6 +35,11 @@ public:
 
 }  // namespace details
 
+int getModelPathStreamIndex() {
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
 /**
  * @brief This class is a wrapper for reader interfaces
  */
@@ -153,6 +159,18 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
         "version of the OpenVINO to generate supported IR version.";
 }
 
+Blob::CPtr mapWeightsFile(const std::string& path) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "mapWeightsFile");
+    auto allocator = details::shared_from_irelease(new MmapAllocator(path));
+    if (0 == allocator->size())
+        return nullptr;
+    auto weights = std::make_shared<TBlob<uint8_t>>(TensorDesc(Precision::U8, {allocator->size()}, Layout::C), allocator);
+    weights->allocate();
+    if (weights->cbuffer() == nullptr)
+        return nullptr;
+    return weights;
+}
+
 }  // namespace
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
@@ -170,6 +188,9 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
     std::ifstream modelStream(model_path, std::ios::binary);
     if (!modelStream.is_open())
         THROW_IE_EXCEPTION << "Model file " << modelPath << " cannot be opened!";
+    // Readers resolve the files the model refers to relative to the model path
+    std::string modelStreamPath = modelPath;
+    modelStream.pword(getModelPathStreamIndex()) = &modelStreamPath;
 
     assertIfIRv7LikeModel(modelStream);
 
@@ -201,6 +222,14 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
 #else
                 std::string weights_path = bPath;
 #endif
+                // Map weights file into memory, so readers can refer to the weights without copying
+                if (auto weights = mapWeightsFile(bPath)) {
+                    details::BlobStream binStream(weights);
+                    auto network = reader->read(modelStream, binStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+
                 std::ifstream binStream;
                 binStream.open(weights_path, std::ios::binary);
                 if (!binStream.is_open())
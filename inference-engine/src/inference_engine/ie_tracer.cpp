@@ -0,0 +1,273 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "details/ie_exception.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+struct Event {
+    std::uint64_t begin;
+    std::uint64_t end;
+    std::uint64_t id;
+    const char* category;
+    char phase;  // 'X' - complete, 'b' / 'e' - asynchronous begin / end
+    char name[55];
+};
+
+/**
+ * @brief A ring buffer written by its thread only, a reader takes the events below the published head.
+ *        It is a seqlock: the writer announces the event it overwrites a slot with before writing it, so the
+ *        reader can drop the copies of the slots which were overwritten while it was copying them.
+ */
+struct ThreadBuffer {
+    ThreadBuffer(std::size_t capacity, std::uint64_t session, int tid, std::string name)
+        : events(capacity), session(session), tid(tid), name(std::move(name)) {}
+
+    void push(const Event& event) noexcept {
+        auto index = head.load(std::memory_order_relaxed);
+        writing.store(index + 1, std::memory_order_relaxed);
+        // The slot must not be written before the in-progress index is visible
+        std::atomic_thread_fence(std::memory_order_release);
+        events[index % events.size()] = event;
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    std::vector<Event> events;
+    std::atomic<std::uint64_t> head{0};
+    // The number of the events including the one being written, so `writing - 1` is the index in progress
+    std::atomic<std::uint64_t> writing{0};
+    const std::uint64_t session;
+    const int tid;
+    const std::string name;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::atomic<bool> enabled{false};
+    // Buffers of previous sessions are dropped by the threads on the next event
+    std::atomic<std::uint64_t> session{0};
+    std::size_t capacity = 0;
+    std::string path;
+    std::uint64_t start = 0;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+struct ThreadState {
+    std::string name;
+    std::shared_ptr<ThreadBuffer> buffer;
+};
+
+thread_local ThreadState threadState;
+
+ThreadBuffer* currentBuffer() {
+    auto& reg = registry();
+    auto session = reg.session.load(std::memory_order_acquire);
+    auto& buffer = threadState.buffer;
+    if (nullptr == buffer || buffer->session != session) {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        if (!reg.enabled || reg.session != session) {
+            return nullptr;
+        }
+        buffer = std::make_shared<ThreadBuffer>(reg.capacity, session, static_cast<int>(reg.buffers.size()),
+                                                threadState.name);
+        reg.buffers.push_back(buffer);
+    }
+    return buffer.get();
+}
+
+void record(char phase, const char* category, const char* name, std::uint64_t begin, std::uint64_t end,
+            std::uint64_t id) noexcept {
+    if (!Tracer::isEnabled()) {
+        return;
+    }
+    ThreadBuffer* buffer = nullptr;
+    try {
+        buffer = currentBuffer();
+    } catch (...) {
+        return;
+    }
+    if (nullptr == buffer) {
+        return;
+    }
+    Event event;
+    event.begin = begin;
+    event.end = end;
+    event.id = id;
+    event.category = category;
+    event.phase = phase;
+    std::strncpy(event.name, name, sizeof(event.name) - 1);
+    event.name[sizeof(event.name) - 1] = '\0';
+    buffer->push(event);
+}
+
+void writeString(std::ostream& out, const char* str) {
+    out << '"';
+    for (; *str != '\0'; ++str) {
+        const char c = *str;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+            out << escaped;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+void writeTime(std::ostream& out, std::uint64_t ns) {
+    // trace_event timestamps are in microseconds
+    char time[32];
+    std::snprintf(time, sizeof(time), "%llu.%03u", static_cast<unsigned long long>(ns / 1000),
+                  static_cast<unsigned>(ns % 1000));
+    out << time;
+}
+
+}  // namespace
+
+void Tracer::start(const std::string& path, std::size_t eventsPerThread) {
+    if (0 == eventsPerThread) {
+        THROW_IE_EXCEPTION << "Tracer needs a non-empty buffer for events";
+    }
+    // The events of the running session are written to its file before they are dropped
+    stop();
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.clear();
+    reg.capacity = eventsPerThread;
+    reg.path = path;
+    reg.start = now();
+    reg.session.fetch_add(1, std::memory_order_release);
+    reg.enabled = true;
+}
+
+void Tracer::stop() {
+    auto& reg = registry();
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        if (!reg.enabled) {
+            return;
+        }
+        reg.enabled = false;
+        path = reg.path;
+    }
+    if (!path.empty()) {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            THROW_IE_EXCEPTION << "Cannot open " << path << " to write the trace";
+        }
+        write(out);
+    }
+}
+
+void Tracer::write(std::ostream& out) {
+    auto& reg = registry();
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::uint64_t start = 0;
+    {
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        buffers = reg.buffers;
+        start = reg.start;
+    }
+
+    auto relative = [&](std::uint64_t ns) { return ns > start ? ns - start : 0; };
+    bool first = true;
+    auto next = [&]() -> std::ostream& {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        return out;
+    };
+
+    out << "{\"traceEvents\":[";
+    for (const auto& buffer : buffers) {
+        if (!buffer->name.empty()) {
+            next() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":";
+            writeString(out, buffer->name.c_str());
+            out << "}}";
+        }
+
+        // The events are copied first, then the copies of the slots the thread has started to overwrite meanwhile
+        // are skipped: the event `writing - 1` overwrites the event `writing - 1 - capacity` and the older ones
+        // are overwritten before it.
+        const auto capacity = static_cast<std::uint64_t>(buffer->events.size());
+        const auto head = buffer->head.load(std::memory_order_acquire);
+        const auto tail = head > capacity ? head - capacity : 0;
+        std::vector<Event> events;
+        for (auto index = tail; index < head; ++index) {
+            events.push_back(buffer->events[index % capacity]);
+        }
+        // The copies must not be reordered after the reading of the in-progress index
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const auto writing = buffer->writing.load(std::memory_order_relaxed);
+        const auto valid = writing > capacity ? std::max(writing - capacity, tail) : tail;
+
+        for (auto index = valid; index < head; ++index) {
+            const auto& event = events[index - tail];
+            next() << "{\"name\":";
+            writeString(out, event.name);
+            out << ",\"cat\":";
+            writeString(out, event.category);
+            out << ",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << buffer->tid << ",\"ts\":";
+            writeTime(out, relative(event.begin));
+            if ('X' == event.phase) {
+                out << ",\"dur\":";
+                writeTime(out, event.end > event.begin ? event.end - event.begin : 0);
+            } else {
+                out << ",\"id\":\"0x" << std::hex << event.id << std::dec << '"';
+            }
+            out << '}';
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool Tracer::isEnabled() noexcept {
+    return registry().enabled.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Tracer::now() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Tracer::complete(const char* category, const char* name, std::uint64_t beginNs, std::uint64_t endNs) noexcept {
+    record('X', category, name, beginNs, endNs, 0);
+}
+
+void Tracer::asyncBegin(const char* category, const char* name, std::uint64_t id, std::uint64_t timeNs) noexcept {
+    record('b', category, name, timeNs, timeNs, id);
+}
+
+void Tracer::asyncEnd(const char* category, const char* name, std::uint64_t id, std::uint64_t timeNs) noexcept {
+    record('e', category, name, timeNs, timeNs, id);
+}
+
+void Tracer::threadName(const std::string& name) {
+    threadState.name = name;
+}
+
+}  // namespace InferenceEngine
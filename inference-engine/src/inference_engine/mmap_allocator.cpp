@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mmap_allocator.hpp"
+
+#include <file_utils.h>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+namespace {
+HANDLE openFile(const std::string& path) {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+    return ::CreateFileW(FileUtils::multiByteCharToWString(path.c_str()).c_str(), GENERIC_READ, FILE_SHARE_READ,
+                         nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    return ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                         nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+}
+}  // namespace
+
+MmapAllocator::MmapAllocator(const std::string& path) : _path(path) {
+    HANDLE file = openFile(_path);
+    if (INVALID_HANDLE_VALUE == file) return;
+    LARGE_INTEGER fileSize;
+    if (::GetFileSizeEx(file, &fileSize)) {
+        _size = static_cast<size_t>(fileSize.QuadPart);
+    }
+    ::CloseHandle(file);
+}
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (0 == size || size > _size) return nullptr;
+    HANDLE file = openFile(_path);
+    if (INVALID_HANDLE_VALUE == file) return nullptr;
+    HANDLE mapping = ::CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (nullptr == mapping) return nullptr;
+    void* data = ::MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, size);
+    // The view keeps the mapping object alive
+    ::CloseHandle(mapping);
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    return nullptr == handle || ::UnmapViewOfFile(handle);
+}
+
+#else
+
+MmapAllocator::MmapAllocator(const std::string& path) : _path(path) {
+    struct stat sb = {};
+    if (::stat(_path.c_str(), &sb) == 0 && S_ISREG(sb.st_mode)) {
+        _size = static_cast<size_t>(sb.st_size);
+    }
+}
+
+void* MmapAllocator::alloc(size_t size) noexcept {
+    if (0 == size || size > _size) return nullptr;
+    int fd = ::open(_path.c_str(), O_RDONLY);
+    if (fd == -1) return nullptr;
+    // Private writable mapping: pages are shared with the page cache until someone writes to them
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file referenced after the descriptor is closed
+    ::close(fd);
+    if (MAP_FAILED == data) return nullptr;
+    _mappedSize = size;
+    return data;
+}
+
+bool MmapAllocator::free(void* handle) noexcept {
+    return nullptr == handle || ::munmap(handle, _mappedSize) == 0;
+}
+
+#endif
+
+MmapAllocator::~MmapAllocator() = default;
@@ -0,0 +1,49 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "ie_allocator.hpp"
+
+/**
+ * @brief Allocator which maps a read-only file into the process address space.
+ *        Memory pages are loaded by the OS lazily on the first access and are shared with the page cache.
+ *        Writes go to private copies of the pages and never reach the file.
+ */
+class MmapAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit MmapAllocator(const std::string& path);
+
+    void Release() noexcept override {
+        delete this;
+    }
+
+    /**
+     * @brief Size of the file that will be mapped by alloc()
+     * @return File size in bytes or 0 if the file cannot be opened
+     */
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void* a) noexcept override {}
+
+    void* alloc(size_t size) noexcept override;
+
+    bool free(void* handle) noexcept override;
+
+protected:
+    ~MmapAllocator() override;
+
+private:
+    std::string _path;
+    size_t _size = 0;
+    size_t _mappedSize = 0;
+};
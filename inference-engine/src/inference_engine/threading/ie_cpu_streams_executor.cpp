@@ -9,6 +9,7 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
 #include <atomic>
 #include <climits>
 #include <cassert>
@@ -17,6 +18,7 @@
 #include "threading/ie_thread_local.hpp"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include "ie_tracer.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "details/ie_exception.hpp"
 #include "threading/ie_cpu_streams_executor.hpp"
@@ -66,11 +68,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
-                : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -146,6 +144,20 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief Per stream task queue. Tasks are pushed to the queue of the stream that enqueued them
+     *        (or distributed round-robin if enqueued from a foreign thread) and idle streams steal
+     *        from other queues, preferring streams on the same NUMA node.
+     */
+    struct TaskQueue {
+        std::mutex                  _mutex;
+        std::condition_variable     _queueCondVar;
+        std::deque<Task>            _tasks;
+        std::atomic<bool>           _isSleeping{false};
+        int                         _numaNodeId = 0;
+        std::vector<int>            _victims;  //!< Queues to steal from: same NUMA node first, then the rest
+    };
+
     explicit Impl(const Config& config) :
         _config{config},
         _streams([this] {
@@ -159,33 +171,112 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue);
+            _taskQueues.back()->_numaNodeId = GetNumaNodeId(streamId);
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            auto& victims = _taskQueues[streamId]->_victims;
+            for (auto sameNumaNode : {true, false}) {
+                for (auto offset = 1; offset < _config._streams; ++offset) {
+                    auto victimId = (streamId + offset) % _config._streams;
+                    if (sameNumaNode == (_taskQueues[victimId]->_numaNodeId == _taskQueues[streamId]->_numaNodeId)) {
+                        victims.push_back(victimId);
+                    }
+                }
+            }
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                Tracer::threadName(_config._name + "_" + std::to_string(streamId));
+                _currentExecutor = this;
+                _currentQueueId = streamId;
+                auto& queue = *_taskQueues[streamId];
+                while (true) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
+                    if (Pop(streamId, task)) {
                         Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(queue._mutex);
+                    queue._isSleeping = true;
+                    queue._queueCondVar.wait(lock, [&] { return (_pendingTasks > 0) || _isStopped; });
+                    queue._isSleeping = false;
+                    if (_isStopped && (_pendingTasks <= 0)) {
+                        break;
                     }
                 }
+                _currentExecutor = nullptr;
             });
         }
     }
 
+    int GetNumaNodeId(const int streamId) const {
+        return _config._streams
+            ? _usedNumaNodes.at(
+                (streamId % _config._streams)/
+                ((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size()))
+            : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
+    static bool TryPop(TaskQueue& queue, Task& task) {
+        std::lock_guard<std::mutex> lock(queue._mutex);
+        if (queue._tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue._tasks.front());
+        queue._tasks.pop_front();
+        return true;
+    }
+
+    bool Pop(const int streamId, Task& task) {
+        if (_pendingTasks <= 0) {
+            return false;
+        }
+        auto& queue = *_taskQueues[streamId];
+        bool found = TryPop(queue, task);
+        for (auto it = queue._victims.begin(); !found && it != queue._victims.end(); ++it) {
+            found = TryPop(*_taskQueues[*it], task);
+        }
+        if (found) {
+            --_pendingTasks;
+        }
+        return found;
+    }
+
     void Enqueue(Task task) {
+        if (Tracer::isEnabled()) {
+            // The wait is an asynchronous interval as it starts on the thread which enqueued the task
+            static std::atomic<std::uint64_t> nextTraceId{0};
+            const auto traceId = nextTraceId++;
+            Tracer::asyncBegin("executor", "queue wait", traceId, Tracer::now());
+            task = [this, traceId, task] {
+                Tracer::asyncEnd("executor", "queue wait", traceId, Tracer::now());
+                TraceScope traceScope("executor", _config._name.c_str());
+                task();
+            };
+        }
+        const auto queueId = (this == _currentExecutor)
+            ? _currentQueueId
+            : static_cast<int>(_nextQueueId++ % _taskQueues.size());
+        auto& queue = *_taskQueues[queueId];
+        ++_pendingTasks;
         {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        // Wake up the owner of the queue if it sleeps, otherwise the nearest sleeping stream that can steal the task
+        auto* sleeping = queue._isSleeping ? &queue : nullptr;
+        for (auto it = queue._victims.begin(); (nullptr == sleeping) && (it != queue._victims.end()); ++it) {
+            if (_taskQueues[*it]->_isSleeping) {
+                sleeping = _taskQueues[*it].get();
+            }
+        }
+        if (nullptr != sleeping) {
+            std::lock_guard<std::mutex> lock(sleeping->_mutex);
+            sleeping->_queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -221,14 +312,20 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
-    std::mutex                              _mutex;
-    std::condition_variable                 _queueCondVar;
-    std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t>                _nextQueueId{0};
+    std::atomic<int>                        _pendingTasks{0};
+    std::atomic<bool>                       _isStopped{false};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
+
+    static thread_local Impl*               _currentExecutor;
+    static thread_local int                 _currentQueueId;
 };
 
+thread_local CPUStreamsExecutor::Impl* CPUStreamsExecutor::Impl::_currentExecutor = nullptr;
+thread_local int CPUStreamsExecutor::Impl::_currentQueueId = 0;
+
 
 int CPUStreamsExecutor::GetStreamId() {
     auto stream = _impl->_streams.local();
@@ -245,11 +342,11 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 }
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
+    _impl->_isStopped = true;
+    for (auto& queue : _impl->_taskQueues) {
+        std::lock_guard<std::mutex> lock(queue->_mutex);
+        queue->_queueCondVar.notify_all();
     }
-    _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_icnn_network.hpp>
+#include <legacy/ie_layers.h>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Serialization {
+
+/**
+ * @brief Serialize network into IE IR XML file and binary weights file
+ * @param xmlPath   Path to XML file
+ * @param binPath   Path to BIN file
+ * @param network   network to be serialized
+ */
+INFERENCE_ENGINE_API_CPP(void) Serialize(const std::string& xmlPath, const std::string& binPath,
+                                         const InferenceEngine::ICNNNetwork& network);
+
+/**
+ * @brief Serialize network into a stream as a single line of IE IR XML followed by
+ *        the 64-bit size of binary weights and the weights themselves
+ * @note The layout matches the one expected by plugins which import networks exported as IR
+ * @param stream    Output stream
+ * @param network   network to be serialized
+ */
+INFERENCE_ENGINE_API_CPP(void) Serialize(std::ostream& stream, const InferenceEngine::ICNNNetwork& network);
+
+}  // namespace Serialization
+}  // namespace InferenceEngine
@@ -28,7 +28,7 @@
 #include "legacy/graph_tools.hpp"
 #include "legacy/details/ie_cnn_network_tools.h"
 #include <legacy/cnn_network_impl.hpp>
-#include "network_serializer_v7.hpp"
+#include "legacy/network_serializer_v7.hpp"
 #include <shape_infer/ie_reshaper.hpp>
 
 using namespace std;
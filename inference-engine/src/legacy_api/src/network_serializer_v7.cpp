@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <queue>
@@ -15,7 +16,7 @@
 #include "legacy/ie_layers.h"
 #include "xml_parse_utils.h"
 #include "exec_graph_info.hpp"
-#include "network_serializer_v7.hpp"
+#include "legacy/network_serializer_v7.hpp"
 
 namespace InferenceEngine {
 namespace Serialization {
@@ -584,5 +585,22 @@ void Serialize(const std::string& xmlPath, const std::string& binPath,
         }
     }
 }
+
+void Serialize(std::ostream& stream, const InferenceEngine::ICNNNetwork& network) {
+    pugi::xml_document doc;
+    auto dataSize = FillXmlDoc(network, doc, false, true);
+    pugi::xml_node netXml = doc.document_element();
+    dataSize = updatePreProcInfo(network, netXml, dataSize);
+
+    doc.save(stream, nullptr, pugi::format_raw);
+    stream << std::endl;
+
+    auto dataSize64 = static_cast<std::uint64_t>(dataSize);
+    stream.write(reinterpret_cast<const char*>(&dataSize64), sizeof(dataSize64));
+    SerializeBlobs(stream, network);
+    if (!stream.good()) {
+        THROW_IE_EXCEPTION << "Error during network serialization to stream";
+    }
+}
 }  //  namespace Serialization
-}  //  namespace InferenceEngine
\ No newline at end of file
+}  //  namespace InferenceEngine
@@ -63,6 +63,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_PERF_COUNT
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS) {
+            if (val == PluginConfigParams::YES) collectHwPerfCounters = true;
+            else if (val == PluginConfigParams::NO) collectHwPerfCounters = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS) {
             if (val == PluginConfigParams::YES) exclusiveAsyncRequests = true;
             else if (val == PluginConfigParams::NO) exclusiveAsyncRequests = false;
@@ -77,6 +83,12 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -87,6 +99,27 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_MEMORY_PLANNER) {
+            static const std::map<std::string, MemorySolver::Planner> planners = {
+                {"GREEDY", MemorySolver::Planner::Greedy},
+                {"BEST_FIT", MemorySolver::Planner::BestFit},
+                {"INTERVAL_COLORING", MemorySolver::Planner::IntervalColoring},
+                {"OPTIMAL", MemorySolver::Planner::Optimal},
+                {"AUTO", MemorySolver::Planner::Auto},
+            };
+            auto planner = planners.find(val);
+            if (planner == planners.end())
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_MEMORY_PLANNER
+                                   << ". Expected only GREEDY/BEST_FIT/INTERVAL_COLORING/OPTIMAL/AUTO";
+            memoryPlanner = planner->second;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT) {
+            if (val == "GREEDY")
+                layoutAssignment = LayoutAssignment::Greedy;
+            else if (val == "GLOBAL")
+                layoutAssignment = LayoutAssignment::Global;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT
+                                   << ". Expected only GREEDY/GLOBAL";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -130,6 +163,10 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_PERF_COUNT, PluginConfigParams::NO });
+        if (collectHwPerfCounters == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_HW_PERF_COUNTERS, PluginConfigParams::NO });
         if (exclusiveAsyncRequests == true)
             _config.insert({ PluginConfigParams::KEY_EXCLUSIVE_ASYNC_REQUESTS, PluginConfigParams::YES });
         else
@@ -138,6 +175,10 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
+        if (parallelBranches == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_PARALLEL_BRANCHES, PluginConfigParams::NO });
 
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -18,13 +19,22 @@ struct Config {
         On,
     };
 
+    enum LayoutAssignment {
+        Greedy,
+        Global,
+    };
+
     bool collectPerfCounters = false;
+    bool collectHwPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool parallelBranches = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    MemorySolver::Planner memoryPlanner = MemorySolver::Planner::Auto;
+    LayoutAssignment layoutAssignment = LayoutAssignment::Greedy;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
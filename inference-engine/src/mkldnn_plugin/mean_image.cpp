@@ -28,9 +28,11 @@ void MeanImage::Load(const MKLDNNDims& inputDims, InputInfo::Ptr inputInfo) {
         case MEAN_VALUE: {
             // mean image common value per channel (1x1xC)
             meanValues.resize(inChannels);
+            stdScales.resize(inChannels);
 
             for (unsigned channel = 0; channel < inChannels; channel++) {
                 meanValues[channel] = pp[channel]->meanValue;
+                stdScales[channel] = pp[channel]->stdScale;
             }
         }
         break;
@@ -97,12 +99,15 @@ void MeanImage::Subtract(const MKLDNNDims &inputDims, float *input, InferenceEng
 
         if (layout == NCHW) {
             parallel_for3d(MB, C, srcSize, [&](int mb, int c, int i) {
-                input[mb * C * srcSize + c * srcSize + i] -= meanValues[c];
+                float& value = input[mb * C * srcSize + c * srcSize + i];
+                value = (value - meanValues[c]) * stdScales[c];
             });
         } else if (layout == NHWC) {
             parallel_for2d(MB, srcSize, [&](int mb, int i) {
-                for (int c = 0; c < C; c++)
-                    input[mb * srcSize * C + i * C + c] -= meanValues[c];
+                for (int c = 0; c < C; c++) {
+                    float& value = input[mb * srcSize * C + i * C + c];
+                    value = (value - meanValues[c]) * stdScales[c];
+                }
             });
         }
     }
@@ -21,6 +21,14 @@ public:
     void Load(const MKLDNNDims& inputDims, InferenceEngine::InputInfo::Ptr inputInfo);
     void Subtract(const MKLDNNDims &inputDims, float *input, InferenceEngine::Layout layout);
 
+    /**
+     * @brief Whether the mean is a value per channel (or there is no mean), so the input normalization
+     * can be done by the input pre-processing
+     */
+    bool isPerChannel() const {
+        return meanBuffer == nullptr;
+    }
+
     template<typename T, typename std::enable_if<std::is_integral<T>::value>::type* = nullptr>
     void Subtract(const MKLDNNDims &inputDims, T *input, InferenceEngine::Layout layout) {
         IE_ASSERT(input != nullptr);
@@ -74,6 +82,7 @@ public:
 
 private:
     std::vector<float> meanValues;
+    std::vector<float> stdScales;
 
     InferenceEngine::TBlob<float>::Ptr meanBuffer;
 };
@@ -15,6 +15,7 @@
 #include "bf16transformer.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
+#include <legacy/network_serializer_v7.hpp>
 #include <threading/ie_executor_manager.hpp>
 #include "low_precision_transformations/convolution.hpp"
 #include "low_precision_transformations/eltwise.hpp"
@@ -25,8 +26,10 @@
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
 #include <algorithm>
+#include <atomic>
 #include <unordered_set>
 #include <utility>
+#include <pugixml.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -41,13 +44,19 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &weightsSharing) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _numaNodesWeights(weightsSharing) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::MKLDNNExecNetwork");
 
+    // The plugin cache is keyed by node names without the data hash, so each network gets its own scope:
+    // networks of the same name may have different weights
+    static std::atomic<std::size_t> networksCount{0};
+    _weightsScope = _name + "#" + std::to_string(networksCount++);
+
     // we are cloning network if we have statistics and we can transform network.
     _clonedNetwork = cloneNet(network);
 
@@ -133,7 +142,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         if (nullptr != streamExecutor) {
             numaNode = streamExecutor->GetNumaNodeId();
         }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
+        auto weightsCache = _numaNodesWeights[numaNode]->scoped(_weightsScope);
+        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, weightsCache);
         return graph;
     }};
 
@@ -142,19 +152,12 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
+    // These states are shared by the infer requests without own states (see MKLDNNInferRequest::QueryState)
     if (_graphs.size() == 1) {
         for (auto &node : _graphs.begin()->get()->GetNodes()) {
             if (node->getType() == MemoryInput) {
                 auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-                auto state_store = memoryNode->getStore();
-                auto state_name = node->getName();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new MKLDNNMemoryState(state_name, state_store));
+                memoryStates.emplace_back(new MKLDNNMemoryState(memoryNode->getStateName(), memoryNode->getStore()));
             }
         }
     }
@@ -187,6 +190,57 @@ void MKLDNNExecNetwork::GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &grap
     graphPtr = _graphs.begin()->get()->dump();
 }
 
+void MKLDNNExecNetwork::ExportImpl(std::ostream& networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+
+    // The v7 serializer does not store bodies of TensorIterator layers
+    for (CNNNetworkIterator i(static_cast<ICNNNetwork*>(_clonedNetwork.get())); i != CNNNetworkIterator(); i++) {
+        if (nullptr != dynamic_cast<TensorIterator*>((*i).get())) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << " Export of networks with TensorIterator layers";
+        }
+    }
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        const auto& preProcess = networkInput.second->getPreProcess();
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+        inputNode.append_attribute("resize").set_value(static_cast<int>(preProcess.getResizeAlgorithm()));
+        inputNode.append_attribute("color").set_value(static_cast<int>(preProcess.getColorFormat()));
+    }
+
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    // The network is stored after low precision and bfloat16 transformations,
+    // so these passes are skipped on import
+    Serialization::Serialize(networkModel, static_cast<ICNNNetwork&>(*_clonedNetwork));
+}
+
 void MKLDNNExecNetwork::GetConfig(const std::string &name, Parameter &result, ResponseDesc *resp) const {
     if (_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
@@ -213,6 +267,11 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(ACTIVATIONS_MEMORY_SIZE));
+        metrics.push_back(METRIC_KEY(ACTIVATIONS_MEMORY_LOWER_BOUND));
+        metrics.push_back(METRIC_KEY(COLLAPSED_ELTWISE_LAYERS));
+        metrics.push_back(METRIC_KEY(HW_PERF_COUNTERS));
+        metrics.push_back(METRIC_KEY(WAVEFRONT_EXECUTION));
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -227,6 +286,38 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto streams = std::stoi(option->second);
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == METRIC_KEY(ACTIVATIONS_MEMORY_SIZE)) {
+        result = IE_SET_METRIC(ACTIVATIONS_MEMORY_SIZE,
+            static_cast<uint64_t>(_graphs.begin()->get()->GetActivationsMemorySize()));
+    } else if (name == METRIC_KEY(ACTIVATIONS_MEMORY_LOWER_BOUND)) {
+        result = IE_SET_METRIC(ACTIVATIONS_MEMORY_LOWER_BOUND,
+            static_cast<uint64_t>(_graphs.begin()->get()->GetActivationsMemoryLowerBound()));
+    } else if (name == METRIC_KEY(COLLAPSED_ELTWISE_LAYERS)) {
+        result = IE_SET_METRIC(COLLAPSED_ELTWISE_LAYERS,
+            static_cast<unsigned int>(_graphs.begin()->get()->GetCollapsedEltwiseLayersCount()));
+    } else if (name == METRIC_KEY(HW_PERF_COUNTERS)) {
+        std::map<std::string, HwPerfCount> perfMap;
+        for (auto g : _graphs)
+            g->GetHwPerfData(perfMap);
+
+        std::map<std::string, std::map<std::string, uint64_t>> counters;
+        for (auto &layer : perfMap) {
+            const auto &sum = layer.second.sum();
+            counters[layer.first] = {
+                {METRIC_VALUE(EXECUTIONS), layer.second.count()},
+                {METRIC_VALUE(REAL_TIME_NS), sum.timeNs},
+                {METRIC_VALUE(CPU_CYCLES), sum.cycles},
+                {METRIC_VALUE(INSTRUCTIONS), sum.instructions},
+                {METRIC_VALUE(LLC_REFERENCES), sum.cacheReferences},
+                {METRIC_VALUE(LLC_MISSES), sum.cacheMisses},
+            };
+        }
+        result = IE_SET_METRIC(HW_PERF_COUNTERS, counters);
+    } else if (name == METRIC_KEY(WAVEFRONT_EXECUTION)) {
+        std::map<std::string, uint64_t> stats;
+        for (auto g : _graphs)
+            g->GetWavefrontData(stats);
+        result = IE_SET_METRIC(WAVEFRONT_EXECUTION, stats);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
@@ -8,6 +8,7 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_weights_cache.hpp"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -42,6 +43,8 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    void ExportImpl(std::ostream& networkModel) override;
+
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
@@ -55,6 +58,8 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    NumaNodesWeights&                           _numaNodesWeights;
+    std::string                                 _weightsScope;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
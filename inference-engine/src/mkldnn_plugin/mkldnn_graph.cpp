@@ -12,6 +12,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <type_traits>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -19,6 +21,7 @@
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_memory_solver.hpp"
+#include "mkldnn_layout_assigner.h"
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
 #include <nodes/mkldnn_reorder_node.h>
@@ -32,6 +35,7 @@
 
 #include "precision_utils.h"
 #include <ie_plugin_config.hpp>
+#include <ie_tracer.hpp>
 #include "low_precision_transformations/transformer.hpp"
 
 #include "utils/blob_dump.h"
@@ -91,11 +95,14 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable caching if graph was created only once, a body graph follows the decision of the outer graph
+    const bool isBody = std::is_same<NET, TensorIterator::Body>::value;
+    weightsCache = config.streamExecutorConfig._streams != 1 || isBody ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
+    // The counters are created before the inferences, so the metric reads them without a race
+    hwPerfCounters.reset(config.collectHwPerfCounters ? new HwPerfCounters() : nullptr);
     status = Ready;
 }
 
@@ -358,6 +365,9 @@ void MKLDNNGraph::InitGraph() {
 
     Allocate();
 
+    if (config.parallelBranches)
+        InitWaves();
+
     CreatePrimitives();
 
     // Do it before cleanup. Because it will lose original layers information
@@ -407,11 +417,19 @@ void MKLDNNGraph::InitGraph() {
     }
 #endif
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (auto &graphNode : graphNodes) {
-        if (!graphNode->isConstant())
-            continue;
-        graphNode->execute(stream);
+    auto executeConstants = [this] {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (auto &graphNode : graphNodes) {
+            if (!graphNode->isConstant())
+                continue;
+            graphNode->execute(stream);
+        }
+    };
+    // Shared constant data is computed by the first graph instance, the others wait for it
+    if (constantsInitFlag) {
+        std::call_once(*constantsInitFlag, executeConstants);
+    } else {
+        executeConstants();
     }
 }
 
@@ -439,6 +457,11 @@ void MKLDNNGraph::InitDescriptors() {
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    if (config.layoutAssignment == Config::LayoutAssignment::Global) {
+        auto stats = MKLDNNLayoutAssigner(graphNodes).assign();
+        avoidedReorders = stats.greedyReorders - std::min(stats.greedyReorders, stats.reorders);
+    }
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -649,8 +672,36 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    // Graph instances created for the streams of one network have identical constant data.
+    // If the weights cache is provided, the constant clusters are allocated in it instead of
+    // the workspace and are filled only once, see InitGraph(). A cluster which is written by
+    // constant and non-constant nodes (in-place case) makes sharing impossible.
+    std::vector<bool> sharedClusters(edge_clasters.size(), false);
+    if (weightsCache) {
+        bool canShare = true;
+        for (int i = 0; i < edge_clasters.size() && canShare; i++) {
+            bool isConst = false, isConstOnly = true;
+            for (auto &edge : edge_clasters[i]) {
+                isConst     |= isConstOutput(edge);
+                isConstOnly &= edge->getParent()->isConstant();
+            }
+            canShare = !isConst || isConstOnly;
+            sharedClusters[i] = isConst;
+        }
+        if (!canShare)
+            sharedClusters.assign(edge_clasters.size(), false);
+    }
+
+    std::vector<MemorySolver::Box> workspaceBoxes;
+    for (int i = 0; i < edge_clasters.size(); i++) {
+        if (!sharedClusters[i])
+            workspaceBoxes.push_back(boxes[i]);
+    }
+
+    MemorySolver memSolver(workspaceBoxes, config.memoryPlanner);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    activationsMemorySize = total_size;
+    activationsMemoryLowerBound = static_cast<size_t>(std::max<int64_t>(memSolver.maxDepth(), 0)) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -659,7 +710,21 @@ void MKLDNNGraph::AllocateWithReuse() {
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
         for (auto &edge : edge_clasters[i]) {
-            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
+            if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation && sharedClusters[i]) {
+                const size_t size = static_cast<size_t>(boxes[i].size) * alignment;
+                const std::string key = _name + "/const_" + edge->getParent()->getName() + "_"
+                                        + std::to_string(edge->getInputNum()) + "_" + std::to_string(size);
+                auto memory = weightsCache->findOrCreate(key, [&] {
+                    MKLDNNMemoryPtr ptr(new MKLDNNMemory(eng));
+                    ptr->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {size}, Layout::C)));
+                    return ptr;
+                });
+                edge->allocate(memory->GetData());
+                sharedConstants.push_back(memory);
+
+                constantsInitFlag = weightsCache->findOrCreateOnceFlag(_name + "/constants");
+                count++;
+            } else if (edge->getStatus() == MKLDNNEdge::Status::NeedAllocation) {
                 int64_t offset = memSolver.getOffset(i);
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
@@ -676,6 +741,48 @@ void MKLDNNGraph::AllocateWithReuse() {
         }
         IE_ASSERT(count == 1);
     }
+
+    // The solver reuses memory of the clusters with disjoint lifetimes assuming sequential execution.
+    // For the parallel execution the nodes writing into a cluster additionally wait for all earlier
+    // users of the same memory: users of the same cluster and of the clusters overlapping with it.
+    memoryDependencies.assign(graphNodes.size(), {});
+    if (config.parallelBranches) {
+        struct Region {
+            int64_t begin, end;
+            int start, finish;
+            std::vector<int> users, writers;
+        };
+        std::vector<Region> regions;
+        for (int i = 0; i < edge_clasters.size(); i++) {
+            if (sharedClusters[i])
+                continue;
+            const int64_t offset = memSolver.getOffset(i);
+            Region region = { offset, offset + boxes[i].size, boxes[i].start,
+                              boxes[i].finish == -1 ? std::numeric_limits<int>::max() : boxes[i].finish, {}, {} };
+            for (auto &edge : edge_clasters[i]) {
+                region.users.push_back(edge->getParent()->execIndex);
+                region.users.push_back(edge->getChild()->execIndex);
+                region.writers.push_back(edge->getParent()->execIndex);
+            }
+            regions.push_back(region);
+        }
+
+        for (auto &region : regions) {
+            for (int writer : region.writers)
+                for (int user : region.users)
+                    if (user < writer)
+                        memoryDependencies[writer].push_back(user);
+        }
+        for (auto &prev : regions) {
+            for (auto &next : regions) {
+                if (prev.finish >= next.start || prev.end <= next.begin || next.end <= prev.begin)
+                    continue;
+                for (int writer : next.writers)
+                    memoryDependencies[writer].insert(memoryDependencies[writer].end(),
+                                                      prev.users.begin(), prev.users.end());
+            }
+        }
+    }
 }
 
 void MKLDNNGraph::Allocate() {
@@ -694,6 +801,39 @@ void MKLDNNGraph::Allocate() {
     for (auto& edge : graphEdges) edge->validate();
 }
 
+void MKLDNNGraph::InitWaves() {
+    waves.clear();
+    // A node is placed into the wave following the latest wave of its data and memory dependencies.
+    // Constant nodes are executed on load only, so they are not scheduled.
+    std::vector<int> nodeWave(graphNodes.size(), -1);
+    int lastMemoryNode = -1;
+    for (auto &node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        int wave = 0;
+        auto dependsOn = [&](int execIndex) {
+            if (nodeWave[execIndex] >= 0)
+                wave = std::max(wave, nodeWave[execIndex] + 1);
+        };
+        for (size_t i = 0; i < node->getParentEdges().size(); i++)
+            dependsOn(node->getParentEdgeAt(i)->getParent()->execIndex);
+        for (int execIndex : memoryDependencies[node->execIndex])
+            dependsOn(execIndex);
+        // Memory layers communicate through the state buffers, so they keep the original order
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput) {
+            if (lastMemoryNode >= 0)
+                dependsOn(lastMemoryNode);
+            lastMemoryNode = node->execIndex;
+        }
+
+        nodeWave[node->execIndex] = wave;
+        if (waves.size() <= static_cast<size_t>(wave))
+            waves.resize(wave + 1);
+        waves[wave].push_back(node);
+    }
+}
+
 void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
@@ -734,6 +874,21 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     }
 }
 
+Blob::Ptr MKLDNNGraph::getNormalizedInputBlob(const std::string& name) {
+    auto input = inputNodes.find(name);
+    auto meanImage = _meanImages.find(name);
+    if (input == inputNodes.end() || meanImage == _meanImages.end() || !meanImage->second.isPerChannel())
+        return nullptr;
+
+    auto blob = input->second->getChildEdgeAt(0)->getBlob();
+    const auto& desc = blob->getTensorDesc();
+    if ((desc.getPrecision() != Precision::FP32 && desc.getPrecision() != Precision::BF16) ||
+        (desc.getLayout() != NCHW && desc.getLayout() != NHWC))
+        return nullptr;
+
+    return blob;
+}
+
 void MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
@@ -758,10 +913,6 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
             ext_blob->allocate();
         }
 
-        if (ext_blob->byteSize() != intr_blob.GetSize())
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
-
         void *ext_blob_ptr = ext_blob->buffer();
         void *intr_blob_ptr = intr_blob.GetData();
 
@@ -773,35 +924,130 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         // TODO: Should we support InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT???
         if (config.batchLimit)
             MB_to_process = std::min<int>(config.batchLimit, MB_to_process);
+
+        // The user blob has other layout or precision, so the data is reordered straight into it
+        if (!CanBindOutput(name, ext_blob->getTensorDesc())) {
+            if (ext_blob->size() != static_cast<size_t>(node->getParentEdgeAt(0)->getDims().size()))
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << ext_blob->size() << "!=" << node->getParentEdgeAt(0)->getDims().size() << ").";
+
+            const auto intrDesc = node->getParentEdgeAt(0)->getDesc();
+            const auto& extDesc = ext_blob->getTensorDesc();
+            // Only the processed batches are reordered if batch is the outermost dimension of both buffers
+            bool skipBatch = MB_to_process != MB && intrDesc.getBlockingDesc().getOrder()[0] == 0 &&
+                             extDesc.getBlockingDesc().getOrder()[0] == 0;
+            auto limitBatch = [&](const TensorDesc& desc) {
+                if (!skipBatch)
+                    return desc;
+                auto dims = desc.getDims();
+                auto blockDims = desc.getBlockingDesc().getBlockDims();
+                dims[0] = blockDims[0] = MB_to_process;
+                return TensorDesc(desc.getPrecision(), dims, {blockDims, desc.getBlockingDesc().getOrder(),
+                                                              desc.getBlockingDesc().getOffsetPadding(),
+                                                              desc.getBlockingDesc().getOffsetPaddingToData(),
+                                                              desc.getBlockingDesc().getStrides()});
+            };
+            MKLDNNMemory src(eng), dst(eng);
+            src.Create(MKLDNNMemoryDesc(limitBatch(intrDesc)), intr_blob_ptr, false);
+            dst.Create(MKLDNNMemoryDesc(limitBatch(extDesc)), ext_blob_ptr, false);
+            dst.SetData(src, false);
+            continue;
+        }
+
+        if (ext_blob->byteSize() != intr_blob.GetSize())
+            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                               << ext_blob->size() << "!=" << intr_blob.GetSize()/sizeof(float) << ").";
+
         size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
 
         cpu_memcpy_s(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
     }
 }
 
+bool MKLDNNGraph::CanBindOutput(const std::string& name, const InferenceEngine::TensorDesc& desc) {
+    for (auto &node : outputNodes) {
+        if (node->getName() != "out_" + name)
+            continue;
+        auto intrDesc = node->getParentEdgeAt(0)->getDesc();
+        // With dynamic batch only the beginning of the memory is written, so batch has to be the outermost dimension
+        const auto& order = desc.getBlockingDesc().getOrder();
+        return desc.getPrecision() == intrDesc.getPrecision() &&
+               desc.getBlockingDesc() == intrDesc.getBlockingDesc() &&
+               (!config.batchLimit || (!order.empty() && order[0] == 0));
+    }
+    return false;
+}
+
 void MKLDNNGraph::Infer(int batch) {
     if (!IsReady()) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
+    TraceScope traceScope("graph", _name.c_str());
 
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    auto executeNodes = [&] {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (batch > 0)
+                graphNodes[i]->setDynamicBatchLim(batch);
+
+            ExecuteNode(graphNodes[i], stream);
+        }
+    };
+    if (hwPerfCounters) {
+        // Hardware events are counted over all threads, so the nodes are executed one by one to be told apart
+        hwPerfCounters->execute(executeNodes);
+    } else if (waves.empty()) {
+        executeNodes();
+    } else {
+        // Batch limit updates memory descriptors shared with neighbour nodes, so it is not done concurrently
+        if (batch > 0) {
+            for (auto &node : graphNodes)
+                node->setDynamicBatchLim(batch);
+        }
+        using Clock = std::chrono::high_resolution_clock;
+        const bool timeWaves = config.collectPerfCounters;
+        auto executeWaveNode = [&](const MKLDNNNodePtr& node, mkldnn::stream& waveStream) {
+            if (!timeWaves) {
+                ExecuteNode(node, waveStream);
+                return;
+            }
+            const auto start = Clock::now();
+            ExecuteNode(node, waveStream);
+            wavesNodesTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+        };
+        const auto start = timeWaves ? Clock::now() : Clock::time_point{};
+        for (auto &wave : waves) {
+            if (wave.size() == 1) {
+                executeWaveNode(wave[0], stream);
+                continue;
+            }
+            parallel_for(wave.size(), [&](size_t i) {
+                mkldnn::stream waveStream = mkldnn::stream(stream::kind::eager);
+                executeWaveNode(wave[i], waveStream);
+            });
+        }
+        if (timeWaves) {
+            wavesRealTimeNs += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+            wavesExecutions++;
+        }
+    }
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+    if (infer_count != -1) infer_count++;
+}
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream) {
+    PERF(node);
+    TraceScope traceScope("node", node->name.c_str());
+    HwPerfHelper hwPerfHelper(hwPerfCounters.get(), node->HwPerfCounter());
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
-            graphNodes[i]->execute(stream);
-        }
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profilingTask);
+        node->execute(stream);
     }
 
-    if (infer_count != -1) infer_count++;
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -888,6 +1134,15 @@ void MKLDNNGraph::SortTopologically() {
     }
 }
 
+size_t MKLDNNGraph::GetCollapsedEltwiseLayersCount() const {
+    size_t count = 0;
+    for (const auto& node : graphNodes) {
+        if (node->getType() == FusedEltwise)
+            count += node->getFusedWith().size() + 1;
+    }
+    return count;
+}
+
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     unsigned i = 0;
     std::function<void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &, const MKLDNNNodePtr&)>
@@ -920,6 +1175,26 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     if (!config.dumpToDot.empty()) dumpToDotFile(config.dumpToDot + "_perf.dot");
 }
 
+void MKLDNNGraph::GetHwPerfData(std::map<std::string, HwPerfCount> &perfMap) const {
+    if (!hwPerfCounters || !hwPerfCounters->available())
+        return;
+    for (auto &node : graphNodes) {
+        const auto count = hwPerfCounters->get(node->hwPerfCounter);
+        if (count.count() > 0)
+            perfMap[node->getName()] += count;
+    }
+}
+
+void MKLDNNGraph::GetWavefrontData(std::map<std::string, uint64_t> &stats) const {
+    if (waves.empty() || wavesExecutions == 0)
+        return;
+
+    stats[METRIC_VALUE(WAVES)] = waves.size();
+    stats[METRIC_VALUE(EXECUTIONS)] += wavesExecutions;
+    stats[METRIC_VALUE(REAL_TIME_NS)] += wavesRealTimeNs;
+    stats[METRIC_VALUE(NODES_TIME_NS)] += wavesNodesTimeNs;
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -11,11 +11,14 @@
 #include "mean_image.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "perf_count_hw.h"
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <atomic>
 
 namespace MKLDNNPlugin {
 
@@ -56,8 +59,20 @@ public:
     }
 
     void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+
+    /**
+     * @brief Returns a blob on the input memory if the input normalization (per channel mean values
+     * and scales) can be fused into the input pre-processing, nullptr otherwise
+     */
+    InferenceEngine::Blob::Ptr getNormalizedInputBlob(const std::string& name);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
+    /**
+     * Checks if a user blob with the descriptor can be used as the memory of the output
+     * with the name directly: it has the same precision and memory layout
+     */
+    bool CanBindOutput(const std::string& name, const InferenceEngine::TensorDesc& desc);
+
     void Infer(int batch = -1);
 
     std::vector<MKLDNNNodePtr>& GetNodes() {
@@ -78,6 +93,29 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /** Adds the hardware events of the executed nodes to perfMap, the graphs of all streams can be merged */
+    void GetHwPerfData(std::map<std::string, HwPerfCount> &perfMap) const;
+
+    /** Adds the timing of the parallel branches execution to stats, the graphs of all streams can be merged */
+    void GetWavefrontData(std::map<std::string, uint64_t> &stats) const;
+
+    /** Size in bytes of the workspace planned for intermediate tensors and its lower bound */
+    size_t GetActivationsMemorySize() const {
+        return activationsMemorySize;
+    }
+
+    size_t GetActivationsMemoryLowerBound() const {
+        return activationsMemoryLowerBound;
+    }
+
+    /** Number of the original elementwise layers executed by FusedEltwise nodes */
+    size_t GetCollapsedEltwiseLayersCount() const;
+
+    /** Number of reorders the global layout assignment avoided comparing to the node by node selection */
+    size_t GetAvoidedReordersCount() const {
+        return avoidedReorders;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -104,6 +142,13 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        sharedConstants.clear();
+        constantsInitFlag.reset();
+        memoryDependencies.clear();
+        waves.clear();
+        wavesExecutions = 0;
+        wavesRealTimeNs = 0;
+        wavesNodesTimeNs = 0;
     }
     Status status;
     Config config;
@@ -115,6 +160,26 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t activationsMemorySize = 0;
+    size_t activationsMemoryLowerBound = 0;
+    size_t avoidedReorders = 0;
+    // constant data shared with other graph instances through the weights cache
+    std::vector<MKLDNNMemoryPtr> sharedConstants;
+    std::shared_ptr<std::once_flag> constantsInitFlag;
+
+    // Parallel branches execution: nodes of one wave do not depend on each other and
+    // are executed concurrently. memoryDependencies[i] are the nodes which must be executed
+    // before the node with execIndex i as they use the same memory.
+    std::vector<std::vector<int>> memoryDependencies;
+    std::vector<std::vector<MKLDNNNodePtr>> waves;
+    // Timing of the waves execution with performance counters enabled: the sum of the node times
+    // divided by the real time of the graph is the achieved concurrency
+    std::atomic<uint64_t> wavesExecutions{0};
+    std::atomic<uint64_t> wavesRealTimeNs{0};
+    std::atomic<uint64_t> wavesNodesTimeNs{0};
+
+    // Counters of the threads of the inference stream if hardware performance counters are enabled
+    std::unique_ptr<HwPerfCounters> hwPerfCounters;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -135,6 +200,8 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
+    void InitWaves();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream);
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
     void do_after(const std::string &dir, const MKLDNNNodePtr &node);
@@ -143,6 +210,7 @@ protected:
     friend class MKLDNNGraphlessInferRequest;
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_net(const MKLDNNGraph &graph);
     friend std::shared_ptr<InferenceEngine::ICNNNetwork> dump_graph_as_ie_ngraph_net(const MKLDNNGraph &graph);
+    friend void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out);
 
 private:
     void dumpToDotFile(std::string file) const;
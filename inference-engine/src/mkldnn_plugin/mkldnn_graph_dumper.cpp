@@ -9,6 +9,7 @@
 #include "exec_graph_info.hpp"
 #include "mkldnn_debug.h"
 #include "generic_ie.hpp"
+#include "nodes/mkldnn_tensoriterator_node.h"
 #include <ngraph/variant.hpp>
 
 #include <vector>
@@ -198,6 +199,8 @@ void dump_graph_as_dot(const MKLDNNGraph &graph, std::ostream &out) {
     auto dump_net = dump_graph_as_ie_net(graph);
     if (dump_net == nullptr)
         THROW_IE_EXCEPTION << "Nullable net dump";
+    if (graph.config.layoutAssignment == Config::LayoutAssignment::Global)
+        out << "// Global layout assignment: " << graph.GetAvoidedReordersCount() << " reorders avoided" << std::endl;
     InferenceEngine::saveGraphToDot(*dump_net, out, drawer_callback);
 }
 
@@ -283,6 +286,12 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
+    // TensorIterator execution details
+    if (auto ti = dynamic_cast<MKLDNNTensorIteratorNode *>(node.get())) {
+        serialization_info["bodyReplicas"] = std::to_string(ti->getBodyReplicasCount());
+        serialization_info["inPlacePorts"] = std::to_string(ti->getInPlacePortsCount());
+    }
+
     return serialization_info;
 }
 
@@ -17,6 +17,7 @@
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_resample_node.h"
+#include "nodes/mkldnn_fused_eltwise_node.h"
 
 #include <blob_factory.hpp>
 #include <legacy/ie_layers_internal.hpp>
@@ -34,6 +35,7 @@
 
 #include <string>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <algorithm>
@@ -135,6 +137,13 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+#if defined(COMPILED_CPU_MKLDNN_FUSED_ELTWISE_NODE)
+    FuseElementwiseSubgraphs(graph);
+    graph.RemoveDroppedNodes();
+    graph.SortTopologically();
+    graph.RemoveDroppedEdges();
+#endif
+
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
@@ -1820,6 +1829,144 @@ void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
     }
 }
 
+#if defined(COMPILED_CPU_MKLDNN_FUSED_ELTWISE_NODE)
+void MKLDNNGraphOptimizer::FuseElementwiseSubgraphs(MKLDNNGraph &graph) {
+    constexpr size_t maxSubgraphSize = 16;
+
+    auto& graphNodes = graph.GetNodes();
+
+    // Nodes are sorted topologically, so a path from the subgraph can't reach the nodes placed before its first node
+    std::map<MKLDNNNode*, size_t> order;
+    for (size_t i = 0; i < graphNodes.size(); i++)
+        order[graphNodes[i].get()] = i;
+
+    auto isReachableFrom = [&](const MKLDNNNodePtr& node, const std::set<MKLDNNNode*>& members, size_t minOrder) {
+        std::vector<MKLDNNNode*> stack = {node.get()};
+        std::set<MKLDNNNode*> visited;
+        while (!stack.empty()) {
+            auto current = stack.back();
+            stack.pop_back();
+            if (!visited.insert(current).second || order[current] < minOrder)
+                continue;
+            for (size_t i = 0; i < current->getParentEdges().size(); i++) {
+                auto parent = current->getParentEdgeAt(i)->getParent();
+                if (members.count(parent.get()))
+                    return true;
+                stack.push_back(parent.get());
+            }
+        }
+        return false;
+    };
+
+    // The subgraph is replaced by one node: only the last node is consumed outside and
+    // no outer path goes from the subgraph back into it
+    auto isClosed = [&](const std::vector<MKLDNNNodePtr>& subgraph) {
+        std::set<MKLDNNNode*> members;
+        for (const auto& node : subgraph)
+            members.insert(node.get());
+
+        for (size_t i = 0; i < subgraph.size(); i++) {
+            const auto& node = subgraph[i];
+            for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+                bool isInner = members.count(node->getChildEdgeAt(j)->getChild().get()) != 0;
+                if (isInner == (i == subgraph.size() - 1))
+                    return false;
+            }
+            for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+                auto parent = node->getParentEdgeAt(j)->getParent();
+                if (!members.count(parent.get()) && isReachableFrom(parent, members, order[subgraph[0].get()]))
+                    return false;
+            }
+        }
+        return true;
+    };
+
+    std::set<MKLDNNNode*> processed;
+    std::vector<MKLDNNNodePtr> fusedNodes;
+    const auto nodes = graphNodes;
+    for (const auto& seed : nodes) {
+        if (processed.count(seed.get()) || !MKLDNNFusedEltwiseNode::isFusingSupported(seed))
+            continue;
+
+        const auto dims = seed->getChildEdgeAt(0)->getDims();
+        std::vector<MKLDNNNodePtr> subgraph = {seed};
+        std::set<MKLDNNNode*> members = {seed.get()};
+        for (size_t i = 0; i < subgraph.size() && subgraph.size() < maxSubgraphSize; i++) {
+            for (size_t j = 0; j < subgraph[i]->getChildEdges().size() && subgraph.size() < maxSubgraphSize; j++) {
+                auto child = subgraph[i]->getChildEdgeAt(j)->getChild();
+                if (members.count(child.get()) || processed.count(child.get()) ||
+                        !MKLDNNFusedEltwiseNode::isFusingSupported(child) || child->getChildEdgeAt(0)->getDims() != dims)
+                    continue;
+
+                bool createsCycle = false;
+                for (size_t k = 0; k < child->getParentEdges().size() && !createsCycle; k++) {
+                    auto parent = child->getParentEdgeAt(k)->getParent();
+                    createsCycle = !members.count(parent.get()) && isReachableFrom(parent, members, order[seed.get()]);
+                }
+                if (createsCycle)
+                    continue;
+
+                subgraph.push_back(child);
+                members.insert(child.get());
+            }
+        }
+        std::sort(subgraph.begin(), subgraph.end(), [&](const MKLDNNNodePtr& a, const MKLDNNNodePtr& b) {
+            return order[a.get()] < order[b.get()];
+        });
+
+        std::shared_ptr<MKLDNNFusedEltwiseNode> fused;
+        for (; subgraph.size() >= 2; subgraph.pop_back()) {
+            if (!isClosed(subgraph))
+                continue;
+
+            const auto& sink = subgraph.back();
+            CNNLayerPtr layer(new CNNLayer({sink->getName(), "FusedEltwise", Precision::FP32}));
+            layer->outData = {sink->getCnnLayer()->outData[0]};
+            fused = std::make_shared<MKLDNNFusedEltwiseNode>(layer, graph.getEngine(), graph.weightsCache);
+            // Per-channel operands would force the plain layout on 4D and 5D tensors, while FuseEltwiseAndSimple
+            // keeps such nodes in the blocked layouts, so only the smaller subgraphs without them are fused
+            if (fused->setSubgraph(subgraph) && (fused->isLayoutAgnostic() || (dims.ndims() != 4 && dims.ndims() != 5)))
+                break;
+            fused.reset();
+        }
+        if (!fused)
+            continue;
+
+        const auto sink = subgraph.back();
+        std::vector<MKLDNNEdgePtr> oldEdges;
+        for (const auto& node : subgraph) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++)
+                oldEdges.push_back(node->getParentEdgeAt(i));
+        }
+        for (size_t i = 0; i < sink->getChildEdges().size(); i++)
+            oldEdges.push_back(sink->getChildEdgeAt(i));
+
+        const auto& externalInputs = fused->getExternalInputs();
+        for (size_t i = 0; i < externalInputs.size(); i++) {
+            MKLDNNEdgePtr edge(new MKLDNNEdge(externalInputs[i].first, fused, externalInputs[i].second, static_cast<int>(i)));
+            graph.GetEdges().push_back(edge);
+            fused->addEdge(edge);
+        }
+        for (size_t i = 0; i < sink->getChildEdges().size(); i++) {
+            auto childEdge = sink->getChildEdgeAt(i);
+            MKLDNNEdgePtr edge(new MKLDNNEdge(fused, childEdge->getChild(), 0, childEdge->getOutputNum()));
+            graph.GetEdges().push_back(edge);
+            fused->addEdge(edge);
+        }
+        // Constant inputs of the FakeQuantize nodes are left without consumers and removed with the subgraph
+        for (auto& edge : oldEdges)
+            edge->drop();
+
+        for (const auto& node : subgraph)
+            processed.insert(node.get());
+        order[fused.get()] = order[sink.get()];
+        fusedNodes.push_back(fused);
+    }
+
+    graphNodes.insert(graphNodes.end(), fusedNodes.begin(), fusedNodes.end());
+}
+#endif
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto isOneOf = [&](mkldnn::algorithm alg, std::vector<mkldnn::algorithm> algs) {
         for (auto a : algs) {
@@ -54,6 +54,9 @@ private:
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
     void FuseBroadcastAndEltwise(MKLDNNGraph &graph);
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
+#if defined(COMPILED_CPU_MKLDNN_FUSED_ELTWISE_NODE)
+    void FuseElementwiseSubgraphs(MKLDNNGraph &graph);
+#endif
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
 
@@ -7,12 +7,15 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 #include <ie_compound_blob.h>
 #include "mkldnn_exec_network.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_memory_state.h"
+#include "nodes/mkldnn_memory_node.hpp"
 
 MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsDataMap     networkInputs,
                                                      InferenceEngine::OutputsDataMap    networkOutputs,
@@ -25,6 +28,10 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
     graph = execNetwork->_graphs.begin()->get();
+    for (auto& node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput)
+            hasMemoryNodes = true;
+    }
     for (const auto& it : _networkInputs) {
         InferenceEngine::Blob::Ptr blob;
         MKLDNNInferRequest::GetBlob(it.first.c_str(), blob);
@@ -82,8 +89,26 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
     graph = execNetwork->_graphs.local().get();
+    if (hasMemoryNodes)
+        bindMemoryStates();
     {
-        execDataPreprocessing(_inputs);
+        // U8 inputs with per channel mean values are resized, converted and normalized by the
+        // pre-processing directly into the graph input memory, so they are not pushed afterwards
+        std::set<std::string> normalizedInputs;
+        for (auto& input : _inputs) {
+            auto it = _preProcData.find(input.first);
+            if (it == _preProcData.end())
+                continue;
+
+            const auto& info = _networkInputs[input.first]->getPreProcess();
+            auto graphBlob = graph->getNormalizedInputBlob(input.first);
+            if (graphBlob && input.second->getTensorDesc().getPrecision() == InferenceEngine::Precision::U8) {
+                it->second->execute(graphBlob, info, false, m_curBatch);
+                normalizedInputs.insert(input.first);
+            } else {
+                it->second->execute(input.second, info, false, m_curBatch);
+            }
+        }
 
         changeDefaultPtr();
 
@@ -96,6 +121,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     << input.first;
             }
 
+            if (normalizedInputs.count(input.first))
+                continue;
+
             InferenceEngine::Blob::Ptr iconv;
             InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
@@ -169,6 +197,41 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+// The graph of a stream is shared by the requests, so each inference points its memory nodes to the stores
+// of the request. The stores are swapped without copying the states.
+void MKLDNNPlugin::MKLDNNInferRequest::bindMemoryStates() {
+    for (auto& node : graph->GetNodes()) {
+        if (node->getType() == MemoryInput) {
+            auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+            if (!memoryNode)
+                THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+            auto found = memoryStores.find(node->getName());
+            memoryNode->setActiveStore(found != memoryStores.end() ? found->second : nullptr);
+        }
+    }
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    if (hasMemoryNodes && memoryStates.empty()) {
+        for (auto& node : graph->GetNodes()) {
+            if (node->getType() == MemoryInput) {
+                auto memoryNode = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
+                if (!memoryNode)
+                    THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to MKLDNNMemoryInputNode";
+
+                // default memory state is zero filled
+                auto store = std::make_shared<MKLDNNMemory>(node->getEngine());
+                store->Create(memoryNode->getStore()->GetDescriptor());
+                store->FillZero();
+
+                memoryStores[node->getName()] = store;
+                memoryStates.emplace_back(new MKLDNNMemoryState(memoryNode->getStateName(), store));
+            }
+        }
+    }
+    return memoryStates;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
     if (!graph || !graph->IsReady())
@@ -230,8 +293,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (graph->CanBindOutput(name, _outputs[name]->getTensorDesc())) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
@@ -319,8 +381,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        if (graph->CanBindOutput(name, data->getTensorDesc())) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -8,6 +8,8 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -43,13 +45,25 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Returns memory states owned by the request.
+     * The request shares the states of the executable network until the first call,
+     * then it infers with own states, so the requests run independent sessions on any CPU stream.
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
     void changeDefaultPtr();
+    void bindMemoryStates();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
+
+    bool                                                    hasMemoryNodes = false;
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
+    std::unordered_map<std::string, MKLDNNMemoryPtr>        memoryStores;
 };
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,56 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_kernel_cache.h"
+
+#include "primitive_attr.hpp"
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Each kernel reserves its own code buffer, so the cache is dropped as a whole when it is full.
+// Kernels stay alive while the nodes using them exist.
+constexpr size_t maxCacheSize = 512;
+
+}  // namespace
+
+void appendKernelKey(std::string& key, const mkldnn_primitive_attr& attr) {
+    const auto& postOps = attr.post_ops_;
+    appendKernelKey(key, postOps.len_);
+    key.append(reinterpret_cast<const char*>(postOps.entry_), postOps.len_ * sizeof(postOps.entry_[0]));
+}
+
+MKLDNNKernelCache& MKLDNNKernelCache::getInstance() {
+    static MKLDNNKernelCache cache;
+    return cache;
+}
+
+std::shared_ptr<void> MKLDNNKernelCache::findOrCreateImpl(const std::string& key,
+                                                          const std::function<std::shared_ptr<void>()>& create) {
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = kernels.find(key);
+        if (found != kernels.end()) {
+            stats.hits++;
+            return found->second;
+        }
+        stats.misses++;
+    }
+
+    // Code generation is done without the lock, so the graphs of the CPU streams are created in parallel
+    auto kernel = create();
+
+    std::unique_lock<std::mutex> lock(guard);
+    if (kernels.size() >= maxCacheSize)
+        kernels.clear();
+    return kernels.emplace(key, kernel).first->second;
+}
+
+MKLDNNKernelCache::Stats MKLDNNKernelCache::getStats() {
+    std::unique_lock<std::mutex> lock(guard);
+    return stats;
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <mkldnn.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+// JIT kernels of the plugin nodes are generated from a small set of parameters and
+// do not keep any state besides the generated code, so equal kernels of different
+// nodes, graph instances of the CPU streams and executable networks share one object.
+// A key is the kernel type, which includes the ISA template argument, and the raw
+// bytes of the constructor arguments. Post ops data pointers are a part of the key,
+// as they are embedded into the generated code.
+
+namespace MKLDNNPlugin {
+
+template <typename T>
+inline void appendKernelKey(std::string& key, const T& params) {
+    static_assert(std::is_pod<T>::value, "Kernel parameters must be a POD type or have appendKernelKey overload");
+    key.append(reinterpret_cast<const char*>(&params), sizeof(params));
+}
+
+inline void appendKernelKey(std::string& key, const std::vector<size_t>& values) {
+    appendKernelKey(key, values.size());
+    key.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(size_t));
+}
+
+void appendKernelKey(std::string& key, const mkldnn_primitive_attr& attr);
+
+/**
+ * Process wide store of the node JIT kernels
+ * Will return a cached kernel or generate new one
+ *
+ * Is a thread safe
+ */
+class MKLDNNKernelCache {
+public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+    };
+
+    static MKLDNNKernelCache& getInstance();
+
+    template <typename Kernel, typename... Args>
+    std::shared_ptr<Kernel> findOrCreate(const Args&... args) {
+        std::string key = typeid(Kernel).name();
+        appendKeys(key, args...);
+        return std::static_pointer_cast<Kernel>(findOrCreateImpl(key, [&] {
+            return std::shared_ptr<void>(new Kernel(args...));
+        }));
+    }
+
+    Stats getStats();
+
+private:
+    MKLDNNKernelCache() = default;
+
+    std::shared_ptr<void> findOrCreateImpl(const std::string& key, const std::function<std::shared_ptr<void>()>& create);
+
+    static void appendKeys(std::string&) {}
+
+    template <typename T, typename... Args>
+    static void appendKeys(std::string& key, const T& value, const Args&... args) {
+        appendKernelKey(key, value);
+        appendKeys(key, args...);
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<void>> kernels;
+    Stats stats;
+    std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
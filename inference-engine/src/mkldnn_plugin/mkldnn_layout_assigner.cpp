@@ -0,0 +1,232 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_layout_assigner.h"
+#include "mkldnn_edge.h"
+#include "mkldnn_extension_utils.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// A lower implementation is assumed to be as expensive as several reorders of its output
+constexpr double implPenalty = 8.0;
+constexpr int maxIterations = 16;
+
+double tensorSize(const InferenceEngine::TensorDesc& desc) {
+    double size = 1;
+    for (auto dim : desc.getDims())
+        size *= dim;
+    return size;
+}
+
+}  // namespace
+
+MKLDNNLayoutAssigner::MKLDNNLayoutAssigner(const std::vector<MKLDNNNodePtr>& graphNodes) {
+    std::map<MKLDNNNode*, size_t> indices;
+    for (const auto& node : graphNodes) {
+        indices[node.get()] = nodes.size();
+        nodes.emplace_back();
+        auto& info = nodes.back();
+        info.node = node;
+
+        const auto& pds = node->getSupportedPrimitiveDescriptors();
+        const auto* selected = node->getSelectedPrimitiveDescriptor();
+        const int selectedIndex = selected ? static_cast<int>(selected - pds.data()) : -1;
+        if (selectedIndex < 0)
+            THROW_IE_EXCEPTION << "Primitive descriptor is not selected for node " << node->getName();
+
+        if (pds.size() < 2 || node->getType() == Concatenation || node->getType() == Split) {
+            info.candidates = {selectedIndex};
+            info.costs = {0};
+            continue;
+        }
+
+        const auto& priority = node->getPrimitivesPriority();
+        auto rank = [&](impl_desc_type type) {
+            return static_cast<size_t>(std::find(priority.begin(), priority.end(), type) - priority.begin());
+        };
+        auto isValid = [&](size_t i) {
+            return pds[i].getConfig().inConfs.size() <= node->getParentEdges().size() &&
+                   rank(pds[i].getImplementationType()) < priority.size();
+        };
+
+        size_t bestRank = priority.size();
+        for (size_t i = 0; i < pds.size(); i++) {
+            if (isValid(i))
+                bestRank = std::min(bestRank, rank(pds[i].getImplementationType()));
+        }
+
+        for (size_t i = 0; i < pds.size(); i++) {
+            if (static_cast<int>(i) != selectedIndex && !isValid(i))
+                continue;
+
+            const auto& config = pds[i].getConfig();
+            double outputSize = 0;
+            for (const auto& outConf : config.outConfs)
+                outputSize += tensorSize(outConf.desc);
+            const size_t implRank = std::min(rank(pds[i].getImplementationType()), priority.size());
+
+            if (static_cast<int>(i) == selectedIndex)
+                info.selected = static_cast<int>(info.candidates.size());
+            info.candidates.push_back(static_cast<int>(i));
+            info.costs.push_back(implRank > bestRank ? (implRank - bestRank) * implPenalty * outputSize : 0);
+        }
+    }
+
+    nodeEdges.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const auto& node = nodes[i].node;
+        for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+            auto edge = node->getChildEdgeAt(j);
+            auto child = indices.find(edge->getChild().get());
+            if (child == indices.end())
+                continue;
+
+            edges.push_back({edge, i, child->second, static_cast<double>(edge->getDims().size())});
+            nodeEdges[i].push_back(edges.size() - 1);
+            nodeEdges[child->second].push_back(edges.size() - 1);
+        }
+    }
+
+    // A node continues the chain of its parent if they are connected by their only edges
+    for (size_t i = 0; i < nodes.size(); i++) {
+        const auto& node = nodes[i].node;
+        if (nodes[i].candidates.size() < 2 || node->getChildEdges().size() != 1)
+            continue;
+
+        auto child = node->getChildEdgeAt(0)->getChild();
+        auto childIndex = indices.find(child.get());
+        if (childIndex == indices.end() || child->getParentEdges().size() != 1 ||
+                nodes[childIndex->second].candidates.size() < 2)
+            continue;
+
+        nodes[i].chainNext = static_cast<int>(childIndex->second);
+        nodes[childIndex->second].chainHead = false;
+    }
+}
+
+double MKLDNNLayoutAssigner::edgeCost(const EdgeInfo& edge, int parentCandidate, int childCandidate) const {
+    const auto& parentConfig = nodes[edge.parent].node->getSupportedPrimitiveDescriptors()[parentCandidate].getConfig();
+    const auto& childConfig = nodes[edge.child].node->getSupportedPrimitiveDescriptors()[childCandidate].getConfig();
+
+    int inNum = edge.edge->getInputNum();
+    if (inNum < 0 || static_cast<size_t>(inNum) >= parentConfig.outConfs.size())
+        inNum = 0;
+    const int outNum = edge.edge->getOutputNum();
+    if (parentConfig.outConfs.empty() || outNum < 0 || static_cast<size_t>(outNum) >= childConfig.inConfs.size())
+        return 0;
+
+    return MKLDNNExtensionUtils::initTensorsAreEqual(childConfig.inConfs[outNum].desc, parentConfig.outConfs[inNum].desc)
+           ? 0 : edge.size;
+}
+
+bool MKLDNNLayoutAssigner::solveChain(const std::vector<size_t>& chain) {
+    auto candidateOf = [&](size_t node) {
+        return nodes[node].candidates[nodes[node].selected];
+    };
+    auto isLink = [&](const EdgeInfo& edge, size_t pos) {
+        return (pos > 0 && edge.parent == chain[pos - 1] && edge.child == chain[pos]) ||
+               (pos + 1 < chain.size() && edge.parent == chain[pos] && edge.child == chain[pos + 1]);
+    };
+
+    // Costs of the node candidates with the neighbours outside of the chain fixed
+    std::vector<std::vector<double>> unary(chain.size());
+    std::vector<const EdgeInfo*> links(chain.size(), nullptr);
+    for (size_t pos = 0; pos < chain.size(); pos++) {
+        const auto& info = nodes[chain[pos]];
+        unary[pos] = info.costs;
+        for (auto edgeIndex : nodeEdges[chain[pos]]) {
+            const auto& edge = edges[edgeIndex];
+            if (isLink(edge, pos)) {
+                if (edge.child == chain[pos])
+                    links[pos] = &edge;
+                continue;
+            }
+            for (size_t k = 0; k < info.candidates.size(); k++) {
+                unary[pos][k] += edge.parent == chain[pos] ? edgeCost(edge, info.candidates[k], candidateOf(edge.child))
+                                                           : edgeCost(edge, candidateOf(edge.parent), info.candidates[k]);
+            }
+        }
+    }
+
+    double current = unary[0][nodes[chain[0]].selected];
+    for (size_t pos = 1; pos < chain.size(); pos++)
+        current += unary[pos][nodes[chain[pos]].selected] + edgeCost(*links[pos], candidateOf(chain[pos - 1]), candidateOf(chain[pos]));
+
+    std::vector<std::vector<double>> total(chain.size());
+    std::vector<std::vector<int>> back(chain.size());
+    total[0] = unary[0];
+    for (size_t pos = 1; pos < chain.size(); pos++) {
+        const auto& prev = nodes[chain[pos - 1]];
+        const auto& info = nodes[chain[pos]];
+        total[pos].assign(info.candidates.size(), std::numeric_limits<double>::max());
+        back[pos].assign(info.candidates.size(), 0);
+        for (size_t k = 0; k < info.candidates.size(); k++) {
+            for (size_t j = 0; j < prev.candidates.size(); j++) {
+                double cost = total[pos - 1][j] + edgeCost(*links[pos], prev.candidates[j], info.candidates[k]);
+                if (cost < total[pos][k]) {
+                    total[pos][k] = cost;
+                    back[pos][k] = static_cast<int>(j);
+                }
+            }
+            total[pos][k] += unary[pos][k];
+        }
+    }
+
+    const auto& last = total.back();
+    int best = static_cast<int>(std::min_element(last.begin(), last.end()) - last.begin());
+    if (last[best] >= current)
+        return false;
+
+    for (size_t pos = chain.size(); pos-- > 0;) {
+        nodes[chain[pos]].selected = best;
+        best = back[pos].empty() ? 0 : back[pos][best];
+    }
+    return true;
+}
+
+size_t MKLDNNLayoutAssigner::countReorders() const {
+    size_t count = 0;
+    for (const auto& edge : edges) {
+        if (edgeCost(edge, nodes[edge.parent].candidates[nodes[edge.parent].selected],
+                     nodes[edge.child].candidates[nodes[edge.child].selected]) > 0)
+            count++;
+    }
+    return count;
+}
+
+MKLDNNLayoutAssigner::Stats MKLDNNLayoutAssigner::assign() {
+    Stats stats;
+    stats.greedyReorders = countReorders();
+
+    std::vector<std::vector<size_t>> chains;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (nodes[i].candidates.size() < 2 || !nodes[i].chainHead)
+            continue;
+        chains.emplace_back();
+        for (int node = static_cast<int>(i); node >= 0; node = nodes[node].chainNext)
+            chains.back().push_back(static_cast<size_t>(node));
+    }
+
+    // Each step doesn't increase the total cost, so the sweeps stop at a local minimum
+    for (int iteration = 0; iteration < maxIterations; iteration++) {
+        bool changed = false;
+        for (const auto& chain : chains)
+            changed = solveChain(chain) || changed;
+        if (!changed)
+            break;
+    }
+
+    for (auto& info : nodes)
+        info.node->selectPrimitiveDescriptorByIndex(info.candidates[info.selected]);
+
+    stats.reorders = countReorders();
+    return stats;
+}
+
+}  // namespace MKLDNNPlugin
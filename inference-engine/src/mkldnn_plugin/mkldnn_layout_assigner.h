@@ -0,0 +1,71 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Selects the primitive descriptors of the graph nodes together, minimizing the total cost
+ * of the graph instead of matching the formats of the parents node by node.
+ *
+ * The cost of a node is a penalty for the implementation types which are lower than the best
+ * available one in the node priority list. The cost of an edge is the size of the tensor if
+ * the descriptors on its ends differ and a reorder is needed. The graph is split into chains
+ * of nodes connected with single edges, each chain is solved exactly by dynamic programming
+ * with the neighbours fixed, and the chains are revisited until the total cost stops decreasing.
+ *
+ * Concatenation and Split nodes choose in-place descriptors by their own rules and are kept as is.
+ */
+class MKLDNNLayoutAssigner {
+public:
+    struct Stats {
+        // Edges needing a reorder with the descriptors selected node by node and after the assignment
+        size_t greedyReorders = 0;
+        size_t reorders = 0;
+    };
+
+    /**
+     * The nodes are sorted topologically and have the initial descriptors selected
+     */
+    explicit MKLDNNLayoutAssigner(const std::vector<MKLDNNNodePtr>& nodes);
+
+    Stats assign();
+
+private:
+    struct NodeInfo {
+        MKLDNNNodePtr node;
+        // Indices of the supported primitive descriptors the node may use and their costs
+        std::vector<int> candidates;
+        std::vector<double> costs;
+        int selected = 0;
+        // The node continues the chain of its only parent
+        int chainNext = -1;
+        bool chainHead = true;
+    };
+
+    struct EdgeInfo {
+        MKLDNNEdgePtr edge;
+        size_t parent;
+        size_t child;
+        // Number of elements to reorder
+        double size;
+    };
+
+    double edgeCost(const EdgeInfo& edge, int parentCandidate, int childCandidate) const;
+    bool solveChain(const std::vector<size_t>& chain);
+    size_t countReorders() const;
+
+    std::vector<NodeInfo> nodes;
+    std::vector<EdgeInfo> edges;
+    std::vector<std::vector<size_t>> nodeEdges;
+};
+
+}  // namespace MKLDNNPlugin
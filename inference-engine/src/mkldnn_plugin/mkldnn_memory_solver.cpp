@@ -7,12 +7,16 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, Planner planner) : _boxes(boxes), _planner(planner) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -56,19 +60,67 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
+inline bool intersectInTime(const MemorySolver::Box &l, const MemorySolver::Box &r) {
+    return l.start <= r.finish && r.start <= l.finish;
+}
+
 int64_t MemorySolver::solve() {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
+
+    std::vector<int64_t> offsets;
+    int64_t min_required = 0;
+    switch (_planner) {
+    case Planner::Greedy:
+        min_required = solveGreedy(offsets);
+        break;
+    case Planner::BestFit:
+        min_required = solveFit(true, offsets);
+        break;
+    case Planner::IntervalColoring:
+        min_required = solveFit(false, offsets);
+        break;
+    case Planner::Optimal:
+    case Planner::Auto: {
+        min_required = solveGreedy(offsets);
+        for (bool bestFit : {true, false}) {
+            std::vector<int64_t> fit_offsets;
+            int64_t fit_required = solveFit(bestFit, fit_offsets);
+            if (fit_required < min_required) {
+                min_required = fit_required;
+                offsets.swap(fit_offsets);
+            }
+        }
+        if (_planner == Planner::Optimal || _boxes.size() <= kOptimalMaxBoxes)
+            min_required = solveOptimal(min_required, offsets);
+        break;
+    }
+    default:
+        THROW_IE_EXCEPTION << "Unknown memory planner";
+    }
+
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = offsets[i];
+
+    return min_required;
+}
+
+int64_t MemorySolver::solveGreedy(std::vector<int64_t>& offsets) const {
+    // id is used to keep the index of box, the offset is stored there during the solution
+    std::vector<Box> boxes(_boxes);
+    for (size_t i = 0; i < boxes.size(); i++) boxes[i].id = i;
+
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
+    offsets.assign(boxes.size(), 0);
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -90,12 +142,124 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;
     }
 
     return _min_required;
 }
 
+int64_t MemorySolver::solveFit(bool bestFit, std::vector<int64_t>& offsets) const {
+    std::vector<size_t> order(_boxes.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (bestFit) {
+        // The biggest and the longest living boxes go first.
+        // Otherwise boxes are placed in execution order as _boxes are sorted by start.
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+            const Box &bl = _boxes[l], &br = _boxes[r];
+            return bl.size > br.size || (bl.size == br.size && bl.finish - bl.start > br.finish - br.start);
+        });
+    }
+
+    int64_t min_required = 0;
+    offsets.assign(_boxes.size(), 0);
+    std::vector<size_t> placed;
+    std::vector<std::pair<int64_t, int64_t>> busy;
+    for (size_t i : order) {
+        const Box &box = _boxes[i];
+        busy.clear();
+        for (size_t j : placed) {
+            if (intersectInTime(box, _boxes[j]))
+                busy.emplace_back(offsets[j], offsets[j] + _boxes[j].size);
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // Look for a gap between the boxes alive at the same time: the smallest suitable one
+        // for best fit and the lowest one for first fit. Put on top if there is no such gap.
+        int64_t top = 0, offset = -1, best_gap = std::numeric_limits<int64_t>::max();
+        for (const auto &b : busy) {
+            const int64_t gap = b.first - top;
+            if (gap >= box.size && gap < best_gap) {
+                offset = top;
+                best_gap = gap;
+                if (!bestFit) break;
+            }
+            top = std::max(top, b.second);
+        }
+        offsets[i] = offset == -1 ? top : offset;
+
+        placed.push_back(i);
+        min_required = std::max(min_required, offsets[i] + box.size);
+    }
+
+    return min_required;
+}
+
+int64_t MemorySolver::solveOptimal(int64_t upperBound, std::vector<int64_t>& offsets) {
+    const int64_t lower_bound = maxDepth();
+    if (upperBound <= lower_bound)
+        return upperBound;
+
+    // There is an optimal solution where each box lies on zero or on top of another box alive
+    // at the same time. Boxes are placed in the order of their offsets, each one is tried on all
+    // such positions. The search is limited by number of box comparisons, so the best found
+    // solution is returned for big problems.
+    static constexpr size_t kOptimalMaxSteps = 1 << 20;
+    size_t steps = 0;
+    int64_t best = upperBound;
+    std::vector<int64_t> current(_boxes.size(), 0);
+    std::vector<bool> is_placed(_boxes.size(), false);
+    std::vector<size_t> placed;
+
+    std::function<void(int64_t, int64_t)> search = [&](int64_t last_offset, int64_t required) {
+        if (placed.size() == _boxes.size()) {
+            best = required;
+            offsets = current;
+            return;
+        }
+        for (size_t i = 0; i < _boxes.size() && best > lower_bound && steps < kOptimalMaxSteps; i++) {
+            if (is_placed[i])
+                continue;
+            const Box &box = _boxes[i];
+            steps += placed.size();
+            std::vector<int64_t> candidates{0};
+            for (size_t j : placed) {
+                if (intersectInTime(box, _boxes[j]))
+                    candidates.push_back(current[j] + _boxes[j].size);
+            }
+            std::sort(candidates.begin(), candidates.end());
+            candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+            for (int64_t offset : candidates) {
+                if (offset < last_offset)
+                    continue;
+                if (std::max(required, offset + box.size) >= best || steps >= kOptimalMaxSteps)
+                    break;
+                steps += placed.size();
+                bool fits = true;
+                for (size_t j : placed) {
+                    if (intersectInTime(box, _boxes[j]) &&
+                        offset < current[j] + _boxes[j].size && current[j] < offset + box.size) {
+                        fits = false;
+                        break;
+                    }
+                }
+                if (!fits)
+                    continue;
+
+                current[i] = offset;
+                is_placed[i] = true;
+                placed.push_back(i);
+                search(offset, std::max(required, offset + box.size));
+                placed.pop_back();
+                is_placed[i] = false;
+            }
+        }
+    };
+    search(0, 0);
+
+    return best;
+}
+
 int64_t MemorySolver::maxDepth() {
     if (_depth == -1) calcDepth();
     return _depth;
@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <vector>
@@ -42,6 +43,19 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The problem is NP-hard, so several planners are available:
+ *  - Greedy: boxes are placed from the biggest one, each is lifted up until it has no intersections
+ *  - BestFit: boxes are placed from the biggest one into the smallest suitable gap between the
+ *    boxes which are alive at the same time
+ *  - IntervalColoring: boxes are placed in the execution order into the lowest suitable gap
+ *    (first fit colouring of the interval graph)
+ *  - Optimal: exhaustive search with pruning, used for small number of boxes only
+ *    (kOptimalMaxBoxes), the best heuristic solution is returned for bigger problems or if
+ *    the search is interrupted
+ *  - Auto: the best solution of the heuristics (and Optimal for small problems)
+ *
+ *  maxDepth() is a lower bound of the solution.
  */
 
 class MemorySolver {
@@ -65,7 +79,19 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Memory planning algorithm */
+    enum class Planner {
+        Greedy,
+        BestFit,
+        IntervalColoring,
+        Optimal,
+        Auto,
+    };
+
+    /** Max number of boxes to be solved by Optimal planner */
+    static constexpr size_t kOptimalMaxBoxes = 16;
+
+    explicit MemorySolver(const std::vector<Box>& boxes, Planner planner = Planner::Greedy);
 
     /**
      * @brief Solve memory location with maximal reuse.
@@ -83,12 +109,17 @@ public:
 
 private:
     std::vector<Box> _boxes;
+    Planner _planner;
     std::map<int64_t, int64_t> _offsets;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+
+    int64_t solveGreedy(std::vector<int64_t>& offsets) const;
+    int64_t solveFit(bool bestFit, std::vector<int64_t>& offsets) const;
+    int64_t solveOptimal(int64_t upperBound, std::vector<int64_t>& offsets);
 };
 
 }  // namespace MKLDNNPlugin
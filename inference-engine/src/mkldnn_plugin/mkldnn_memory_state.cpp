@@ -4,6 +4,7 @@
 
 #include "mkldnn_memory_state.h"
 #include "mkldnn_extension_utils.h"
+#include "blob_factory.hpp"
 
 using namespace InferenceEngine;
 
@@ -28,8 +29,17 @@ void  MKLDNNMemoryState::SetState(Blob::Ptr newState) {
 }
 
 InferenceEngine::Blob::CPtr MKLDNNMemoryState::GetLastState() const {
-    THROW_IE_EXCEPTION << "GetLastState method is not implemented for MemoryState";
-    return nullptr;
+    auto dims = storage->GetDims();
+    SizeVector blobDims(dims.begin(), dims.end());
+    auto prec = MKLDNNExtensionUtils::DataTypeToIEPrecision(storage->GetDataType());
+    auto blob = make_blob_with_precision(TensorDesc(prec, blobDims, TensorDesc::getLayoutByDims(blobDims)));
+    blob->allocate();
+
+    // The state is returned as a snapshot, the following inferences do not modify it
+    MKLDNNMemory plain(storage->GetPrimitive().get_primitive_desc().get_engine());
+    plain.Create(dims, storage->GetDataType(), MKLDNNMemory::GetPlainFormat(dims), blob->buffer().as<void*>());
+    plain.SetData(*storage, false);
+    return blob;
 }
 
 }  // namespace MKLDNNPlugin
\ No newline at end of file
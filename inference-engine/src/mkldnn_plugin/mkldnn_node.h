@@ -20,6 +20,7 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
 #include "mkldnn_weights_cache.hpp"
+#include "perf_count_hw.h"
 #include "mkldnn.hpp"
 #include <openvino/itt.hpp>
 
@@ -76,7 +77,8 @@ enum Type {
     Normalize,
     ScatterUpdate,
     ScatterElementsUpdate,
-    ScatterNDUpdate
+    ScatterNDUpdate,
+    FusedEltwise
 };
 
 Type TypeFromName(const std::string type);
@@ -165,6 +167,8 @@ static std::string NameFromType(Type type) {
             return "ScatterElementsUpdate";
         case ScatterNDUpdate:
             return "ScatterNDUpdate";
+        case FusedEltwise:
+            return "FusedEltwise";
         default:
             return "Unknown";
     }
@@ -335,6 +339,7 @@ public:
     std::string getPrimitiveDescriptorType();
 
     PerfCount &PerfCounter() { return perfCounter; }
+    HwPerfCount &HwPerfCounter() { return hwPerfCounter; }
 
     virtual void setDynamicBatchLim(int lim);
 
@@ -517,6 +522,7 @@ protected:
     friend class MKLDNNEdge;
     friend class MKLDNNGraph;
     friend class MKLDNNGraphOptimizer;
+    friend class MKLDNNLayoutAssigner;
 
     bool isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const;
     bool isInitConfig(const InferenceEngine::LayerConfig& config) const;
@@ -547,6 +553,7 @@ private:
     std::string typeToStr(Type type);
 
     PerfCount perfCounter;
+    HwPerfCount hwPerfCounter;
     openvino::itt::handle_t profilingTask;
 
     bool isEdgesEmpty(const std::vector<MKLDNNEdgeWeakPtr>& edges) const;
@@ -5,8 +5,8 @@
 #include "ie_metric_helpers.hpp"
 #include "mkldnn_plugin.h"
 #include "mkldnn_extension_mngr.h"
-#include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_kernel_cache.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
@@ -20,6 +20,7 @@
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_transformer.h>
 #include <legacy/ie_ngraph_utils.hpp>
+#include <xml_parse_utils.h>
 
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <transformations/common_optimizations/common_optimizations.hpp>
@@ -184,6 +185,94 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
     return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
 }
 
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
+    }
+
+    std::string cpuXmlStr;
+    std::getline(networkModel, cpuXmlStr);
+
+    pugi::xml_document cpuXmlDoc;
+    pugi::xml_parse_result res = cpuXmlDoc.load(cpuXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+    pugi::xml_node cpuNode = cpuXmlDoc.document_element();
+
+    std::map<std::string, std::string> importedConfigs;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        importedConfigs.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    for (auto&& c : config) {
+        importedConfigs[c.first] = c.second;
+    }
+
+    Config conf = engConfig;
+    conf.readProperties(importedConfigs);
+    // exported network has been already transformed
+    conf.lpTransformsMode = Config::LPTransformsMode::Off;
+
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading exported CPU network";
+    }
+
+    auto cnnnetwork = GetCore()->ReadNetwork(xmlString, std::move(dataBlob));
+
+    auto inputs = cnnnetwork.getInputsInfo();
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto input = inputs.find(GetStrAttr(inputNode, "name"));
+        if (input == inputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network has no input " << GetStrAttr(inputNode, "name");
+        }
+        input->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        input->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+        input->second->getPreProcess().setResizeAlgorithm(static_cast<ResizeAlgorithm>(GetIntAttr(inputNode, "resize")));
+        input->second->getPreProcess().setColorFormat(static_cast<ColorFormat>(GetIntAttr(inputNode, "color")));
+    }
+
+    auto outputs = cnnnetwork.getOutputsInfo();
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto output = outputs.find(GetStrAttr(outputNode, "name"));
+        if (output == outputs.end()) {
+            THROW_IE_EXCEPTION << "Exported CPU network has no output " << GetStrAttr(outputNode, "name");
+        }
+        output->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        output->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+    }
+
+    auto impl = std::make_shared<MKLDNNExecNetwork>(static_cast<const ICNNNetwork&>(cnnnetwork), conf, extensionManager, weightsSharing);
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(inputs, outputs, networkInputs, networkOutputs);
+    impl->setNetworkInputs(networkInputs);
+    impl->setNetworkOutputs(networkOutputs);
+    impl->SetPointerToPlugin(shared_from_this());
+
+    return make_executable_network(impl);
+}
+
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     engConfig.readProperties(config);
@@ -224,6 +313,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(KERNEL_CACHE_HITS));
+        metrics.push_back(METRIC_KEY(KERNEL_CACHE_MISSES));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -270,6 +362,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(KERNEL_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(KERNEL_CACHE_HITS, static_cast<unsigned int>(MKLDNNKernelCache::getInstance().getStats().hits));
+    } else if (name == METRIC_KEY(KERNEL_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(KERNEL_CACHE_MISSES, static_cast<unsigned int>(MKLDNNKernelCache::getInstance().getStats().misses));
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -13,38 +13,14 @@
 #include <mutex>
 #include <map>
 
-// TODO: While CPU plugin has no ease way to clone graph object we use weight
-//       caching in global Engine context to avoid tensor memory duplication.
-//       For same cases it may be switched of (like for single stream execution)
-//       When MKLDNNGraph clone function will be ready you may removed this
-//       classes at all.
+// Weights and constant tensors are computed once per executable network and
+// shared between the graph instances created for each CPU stream. The store
+// is owned by the plugin, every executable network works with its own scope
+// of it, so a stored object is identified by the network scope, its owner
+// node name and port without hashing the data.
 
 namespace MKLDNNPlugin {
 
-class SimpleDataHash {
-public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
-
-protected:
-    static const int kTableSize = 256;
-    uint64_t table[kTableSize];
-};
-
 /**
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
@@ -54,24 +30,58 @@ protected:
 class MKLDNNWeightsSharing {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
+
+    MKLDNNWeightsSharing() : storage(std::make_shared<Storage>()) {}
+
+    /**
+     * Returns a view of the same store, which prefixes the names of the objects by the scope.
+     * Node names are unique only within one graph, so a nested graph uses the scope of its owner
+     */
+    Ptr scoped(const std::string& scope) const {
+        return Ptr(new MKLDNNWeightsSharing(storage, prefix + scope + "/"));
+    }
+
     MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
                              std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
+        std::unique_lock<std::mutex> lock(storage->guard);
+        auto found = storage->sharedWeights.find(prefix + name_hash);
 
         MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
+        if (found == storage->sharedWeights.end() || !(ptr = found->second.lock())) {
             ptr = create();
-            sharedWeights[name_hash] = ptr;
+            storage->sharedWeights[prefix + name_hash] = ptr;
         }
         return ptr;
     }
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+
+    /**
+     * Returns the flag guarding one-time initialization of the shared objects
+     * identified by the name. Is used to compute constant data once per cache
+     */
+    std::shared_ptr<std::once_flag> findOrCreateOnceFlag(const std::string& name) {
+        std::unique_lock<std::mutex> lock(storage->guard);
+        auto& found = storage->onceFlags[prefix + name];
+
+        auto flag = found.lock();
+        if (!flag) {
+            flag = std::make_shared<std::once_flag>();
+            found = flag;
+        }
+        return flag;
+    }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
-    std::mutex guard;
-    static const SimpleDataHash simpleCRC;
+    struct Storage {
+        std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
+        std::unordered_map<std::string, std::weak_ptr<std::once_flag>> onceFlags;
+        std::mutex guard;
+    };
+
+    MKLDNNWeightsSharing(const std::shared_ptr<Storage>& storage, const std::string& prefix) :
+        storage(storage), prefix(prefix) {}
+
+    std::shared_ptr<Storage> storage;
+    std::string prefix;
 };
 
 /**
@@ -9,6 +9,7 @@
 #include <memory>
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
+#include "mkldnn_kernel_cache.h"
 
 using namespace mkldnn::impl::cpu;
 using namespace mkldnn::impl::utils;
@@ -196,15 +197,15 @@ public:
             } else {
                 if (mayiuse(avx512_common)) {
                     blk_layout = ConfLayout::BLK16;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<avx512_common>());
+                    interp_kernel = MKLDNNPlugin::MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_interp_kernel_f32<avx512_common>>();
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 } else if (mayiuse(avx2)) {
                     blk_layout = ConfLayout::BLK8;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<avx2>());
+                    interp_kernel = MKLDNNPlugin::MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_interp_kernel_f32<avx2>>();
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 } else {
                     blk_layout = ConfLayout::BLK8;
-                    interp_kernel.reset(new jit_uni_interp_kernel_f32<sse42>());
+                    interp_kernel = MKLDNNPlugin::MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_interp_kernel_f32<sse42>>();
                     addConfig(layer, { DataConfigurator(blk_layout) }, { DataConfigurator(blk_layout) });
                 }
             }
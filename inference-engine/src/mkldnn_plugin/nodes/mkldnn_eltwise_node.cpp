@@ -11,6 +11,7 @@
 #include <cmath>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_quantize_node.h"
 #include "mkldnn_activation_node.h"
@@ -567,11 +568,11 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         jep.eltwise_op = op;
 
         if (mayiuse(cpu::avx512_common)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx512_common>(jep, *attr.get()));
+            eltiwse_fq_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_eltwise_fq_generic<cpu::avx512_common>>(jep, *attr.get());
         } else if (mayiuse(cpu::avx2)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::avx2>(jep, *attr.get()));
+            eltiwse_fq_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_eltwise_fq_generic<cpu::avx2>>(jep, *attr.get());
         } else if (mayiuse(cpu::sse42)) {
-            eltiwse_fq_kernel.reset(new jit_uni_eltwise_fq_generic<cpu::sse42>(jep, *attr.get()));
+            eltiwse_fq_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_eltwise_fq_generic<cpu::sse42>>(jep, *attr.get());
         }
     }
 }
@@ -0,0 +1,645 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_fused_eltwise_node.h"
+#include "mkldnn_activation_node.h"
+#include "mkldnn_depthwise_node.h"
+#include "mkldnn_quantize_node.h"
+#include <legacy/ie_layers.h>
+#include <mkldnn.hpp>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <numeric>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
+#include "ie_parallel.hpp"
+#include "jit_generator.hpp"
+#include "jit_uni_eltwise.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_fused_eltwise_call_args, field)
+
+namespace {
+
+constexpr int maxVectorRegisters = 16;
+constexpr size_t minBlockSize = 256;
+
+// Vector registers of the op arguments and result, -1 is set for the missing argument
+struct jit_fused_eltwise_regs {
+    int src0;
+    int src1;
+    int dst;
+};
+
+// Intermediate values live in registers until their last use, memory inputs are loaded right before the op.
+// Returns the number of the registers the program needs.
+int assignRegisters(const jit_fused_eltwise_params& jfp, std::vector<jit_fused_eltwise_regs>& regs) {
+    const int inputsNum = jfp.inputs_num;
+    std::vector<int> lastUse(jfp.ops_num, -1);
+    for (int i = 0; i < jfp.ops_num; i++) {
+        for (int src : {jfp.ops[i].src0, jfp.ops[i].src1}) {
+            if (src >= inputsNum)
+                lastUse[src - inputsNum] = i;
+        }
+    }
+    // The result of the last op is stored to the output
+    lastUse[jfp.ops_num - 1] = jfp.ops_num;
+
+    std::vector<bool> busy;
+    auto allocate = [&]() {
+        auto freeReg = std::find(busy.begin(), busy.end(), false);
+        if (freeReg != busy.end()) {
+            *freeReg = true;
+            return static_cast<int>(freeReg - busy.begin());
+        }
+        busy.push_back(true);
+        return static_cast<int>(busy.size() - 1);
+    };
+
+    regs.resize(jfp.ops_num);
+    std::vector<int> valueRegs(jfp.ops_num, -1);
+    for (int i = 0; i < jfp.ops_num; i++) {
+        const auto& op = jfp.ops[i];
+        std::vector<std::pair<int, int>> loaded;
+        auto getReg = [&](int value) {
+            if (value < 0)
+                return -1;
+            if (value >= inputsNum)
+                return valueRegs[value - inputsNum];
+            for (const auto& input : loaded) {
+                if (input.first == value)
+                    return input.second;
+            }
+            loaded.emplace_back(value, allocate());
+            return loaded.back().second;
+        };
+
+        regs[i].src0 = getReg(op.src0);
+        regs[i].src1 = getReg(op.src1);
+        const bool src0Dies = op.src0 < inputsNum || lastUse[op.src0 - inputsNum] == i;
+        regs[i].dst = src0Dies ? regs[i].src0 : allocate();
+        valueRegs[i] = regs[i].dst;
+
+        for (const auto& input : loaded) {
+            if (input.second != regs[i].dst)
+                busy[input.second] = false;
+        }
+        for (int src : {op.src0, op.src1}) {
+            if (src >= inputsNum && lastUse[src - inputsNum] == i && valueRegs[src - inputsNum] != regs[i].dst)
+                busy[valueRegs[src - inputsNum]] = false;
+        }
+    }
+
+    return static_cast<int>(busy.size());
+}
+
+}  // namespace
+
+template <cpu_isa_t isa>
+struct jit_uni_fused_eltwise_generic : public jit_uni_fused_eltwise_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fused_eltwise_generic)
+
+    explicit jit_uni_fused_eltwise_generic(jit_fused_eltwise_params jfp) : jit_uni_fused_eltwise_kernel(jfp), jit_generator() {
+        assignRegisters(jfp_, regs);
+        for (int i = 0; i < jfp_.ops_num; i++) {
+            const auto& op = jfp_.ops[i];
+            if (op.type == FusedEltwiseOpType::Activation) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, mkldnn::convert_to_c(op.alg), op.alpha, op.beta));
+            } else {
+                eltwise_injectors.push_back(nullptr);
+            }
+        }
+
+        this->preamble();
+
+        for (int i = 0; i < jfp_.inputs_num; i++)
+            mov(reg_src[i], ptr[reg_params + GET_OFF(src) + i * sizeof(float*)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label main_loop_end_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label tail_loop_end_label;
+
+        L(main_loop_label);
+        {
+            cmp(reg_work_amount, simd_w);
+            jl(main_loop_end_label, T_NEAR);
+
+            compute(false);
+
+            for (int i = 0; i < jfp_.inputs_num; i++) {
+                if (!jfp_.broadcast[i])
+                    add(reg_src[i], simd_w * sizeof(float));
+            }
+            add(reg_dst, simd_w * sizeof(float));
+            sub(reg_work_amount, simd_w);
+
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(main_loop_end_label);
+
+        L(tail_loop_label);
+        {
+            cmp(reg_work_amount, 1);
+            jl(tail_loop_end_label, T_NEAR);
+
+            compute(true);
+
+            for (int i = 0; i < jfp_.inputs_num; i++) {
+                if (!jfp_.broadcast[i])
+                    add(reg_src[i], sizeof(float));
+            }
+            add(reg_dst, sizeof(float));
+            sub(reg_work_amount, 1);
+
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_end_label);
+
+        this->postamble();
+
+        for (auto& inj : eltwise_injectors) {
+            if (inj)
+                inj->prepare_table();
+        }
+
+        ker_ = (decltype(ker_)) this->getCode();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::sse42, Xbyak::Xmm, isa == cpu::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    void load(int reg, int input, bool is_tail) {
+        if (is_tail)
+            movss(Xmm(reg), ptr[reg_src[input]]);
+        else if (jfp_.broadcast[input])
+            uni_vbroadcastss(Vmm(reg), ptr[reg_src[input]]);
+        else
+            uni_vmovups(Vmm(reg), ptr[reg_src[input]]);
+    }
+
+    void compute(bool is_tail) {
+        for (int i = 0; i < jfp_.ops_num; i++) {
+            const auto& op = jfp_.ops[i];
+            const auto& r = regs[i];
+
+            // Inputs are loaded to the registers picked for them by assignRegisters
+            if (op.src0 < jfp_.inputs_num)
+                load(r.src0, op.src0, is_tail);
+            if (op.src1 >= 0 && op.src1 < jfp_.inputs_num && op.src1 != op.src0)
+                load(r.src1, op.src1, is_tail);
+
+            Vmm vmm_dst = Vmm(r.dst);
+            if (r.dst != r.src0)
+                uni_vmovups(vmm_dst, Vmm(r.src0));
+
+            switch (op.type) {
+                case FusedEltwiseOpType::Add: uni_vaddps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::Sub: uni_vsubps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::Mul: uni_vmulps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::Div: uni_vdivps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::Max: uni_vmaxps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::Min: uni_vminps(vmm_dst, vmm_dst, Vmm(r.src1)); break;
+                case FusedEltwiseOpType::SquaredDiff:
+                    uni_vsubps(vmm_dst, vmm_dst, Vmm(r.src1));
+                    uni_vmulps(vmm_dst, vmm_dst, vmm_dst);
+                    break;
+                case FusedEltwiseOpType::Round: uni_vroundps(vmm_dst, vmm_dst, 0); break;
+                case FusedEltwiseOpType::Activation:
+                    eltwise_injectors[i]->compute_vector_range(r.dst, r.dst + 1);
+                    break;
+                default: THROW_IE_EXCEPTION << "Unsupported operation type for FusedEltwise node";
+            }
+        }
+
+        const int result = regs[jfp_.ops_num - 1].dst;
+        if (is_tail)
+            movss(ptr[reg_dst], Xmm(result));
+        else
+            uni_vmovups(ptr[reg_dst], Vmm(result));
+    }
+
+    const Xbyak::Reg64 reg_src[MAX_FUSED_ELTWISE_INPUTS] = {r8, r9, r10, r11, r12, r13, r14, r15};
+    Xbyak::Reg64 reg_dst = rbx;
+    Xbyak::Reg64 reg_work_amount = rdx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    std::vector<jit_fused_eltwise_regs> regs;
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+};
+
+MKLDNNFusedEltwiseNode::MKLDNNFusedEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng,
+                                               MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(layer, eng, cache) {}
+
+bool MKLDNNFusedEltwiseNode::isFusingSupported(const MKLDNNNodePtr& node) {
+    auto layer = node->getCnnLayer();
+    if (!layer || layer->outData.size() != 1 || layer->outData[0]->getPrecision() != Precision::FP32 ||
+            node->getChildEdges().empty() || !node->getFusedWith().empty() || !node->getMergeWith().empty())
+        return false;
+
+    auto isFP32Input = [&](size_t port) {
+        return port < layer->insData.size() && layer->insData[port].lock() &&
+               layer->insData[port].lock()->getPrecision() == Precision::FP32;
+    };
+
+    switch (node->getType()) {
+        case Eltwise: {
+            auto* eltwiseLayer = dynamic_cast<EltwiseLayer*>(layer.get());
+            if (eltwiseLayer == nullptr)
+                return false;
+            auto op = eltwiseLayer->_operation;
+            if (op != EltwiseLayer::Sum && op != EltwiseLayer::Prod && op != EltwiseLayer::Max &&
+                    op != EltwiseLayer::Min && op != EltwiseLayer::Sub && op != EltwiseLayer::Div &&
+                    op != EltwiseLayer::Squared_diff)
+                return false;
+            if (op == EltwiseLayer::Squared_diff && layer->insData.size() != 2)
+                return false;
+            for (auto coeff : eltwiseLayer->coeff) {
+                if (coeff != 1.f)
+                    return false;
+            }
+            for (size_t port = 0; port < layer->insData.size(); port++) {
+                if (!isFP32Input(port))
+                    return false;
+            }
+            return layer->insData.size() >= 2;
+        }
+        case Activation: {
+            auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+            if (activationNode == nullptr || !isFP32Input(0))
+                return false;
+            const std::vector<mkldnn::algorithm> algs = {eltwise_relu, eltwise_gelu, eltwise_elu, eltwise_logistic,
+                eltwise_bounded_relu, eltwise_clamp, eltwise_tanh, eltwise_swish, eltwise_hswish, eltwise_mish, eltwise_linear,
+                eltwise_abs, eltwise_square, eltwise_sqrt};
+            return std::find(algs.begin(), algs.end(), activationNode->getAlgorithm()) != algs.end();
+        }
+        case Power: {
+            auto* powerLayer = dynamic_cast<PowerLayer*>(layer.get());
+            if (powerLayer == nullptr || !isFP32Input(0))
+                return false;
+            return powerLayer->power == 1.f || powerLayer->power == 2.f || powerLayer->power == 0.5f ||
+                   powerLayer->power == -1.f;
+        }
+        case Depthwise: {
+            auto* depthwiseNode = dynamic_cast<MKLDNNDepthwiseNode*>(node.get());
+            auto* scshLayer = dynamic_cast<ScaleShiftLayer*>(layer.get());
+            if (depthwiseNode == nullptr || scshLayer == nullptr || !isFP32Input(0) ||
+                    depthwiseNode->getAlgorithm() != mkldnn::algorithm::depthwise_scale_shift)
+                return false;
+            if (!scshLayer->_weights || scshLayer->_weights->getTensorDesc().getPrecision() != Precision::FP32)
+                return false;
+            return !scshLayer->_biases || scshLayer->_biases->getTensorDesc().getPrecision() == Precision::FP32;
+        }
+        case Quantize: {
+            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+            return quantizeNode != nullptr && !quantizeNode->isBinarization() && isFP32Input(0);
+        }
+        default:
+            return false;
+    }
+}
+
+bool MKLDNNFusedEltwiseNode::setSubgraph(const std::vector<MKLDNNNodePtr>& nodes) {
+    if (nodes.empty())
+        return false;
+
+    const auto& sink = nodes.back();
+    outputDims = sink->getChildEdgeAt(0)->getDims().ToSizeVector();
+
+    externalInputs.clear();
+    operands.clear();
+    inDims.clear();
+
+    std::vector<jit_fused_eltwise_op> ops;
+    std::map<MKLDNNNode*, int> nodeValues;
+    // Op results are distinguished from the operands until the operands number is known
+    constexpr int opsOffset = 1 << 16;
+
+    auto getInput = [&](const MKLDNNEdgePtr& edge) {
+        auto parent = edge->getParent();
+        auto value = nodeValues.find(parent.get());
+        if (value != nodeValues.end())
+            return value->second;
+
+        for (size_t i = 0; i < operands.size(); i++) {
+            int port = operands[i].port;
+            if (port >= 0 && externalInputs[port].first == parent && externalInputs[port].second == edge->getInputNum())
+                return static_cast<int>(i);
+        }
+        operands.emplace_back();
+        operands.back().port = static_cast<int>(externalInputs.size());
+        operands.back().dims = edge->getDims().ToSizeVector();
+        externalInputs.emplace_back(parent, edge->getInputNum());
+        inDims.push_back(edge->getDims());
+        return static_cast<int>(operands.size() - 1);
+    };
+    auto getConstant = [&](const std::vector<float>& data, size_t axis) {
+        operands.emplace_back();
+        operands.back().constant = data;
+        operands.back().dims = SizeVector(outputDims.size(), 1);
+        if (data.size() != 1 && axis < outputDims.size())
+            operands.back().dims[axis] = data.size();
+        return static_cast<int>(operands.size() - 1);
+    };
+    auto addOp = [&](FusedEltwiseOpType type, int src0, int src1, mkldnn::algorithm alg = algorithm_undef,
+                     float alpha = 0.f, float beta = 0.f) {
+        jit_fused_eltwise_op op = {type, alg, alpha, beta, src0, src1};
+        ops.push_back(op);
+        return opsOffset + static_cast<int>(ops.size() - 1);
+    };
+
+    const size_t channelAxis = outputDims.size() > 1 ? 1 : 0;
+    for (const auto& node : nodes) {
+        int value = -1;
+        auto layer = node->getCnnLayer();
+        switch (node->getType()) {
+            case Eltwise: {
+                static const std::map<EltwiseLayer::eOperation, FusedEltwiseOpType> opTypes = {
+                    {EltwiseLayer::Sum, FusedEltwiseOpType::Add}, {EltwiseLayer::Prod, FusedEltwiseOpType::Mul},
+                    {EltwiseLayer::Max, FusedEltwiseOpType::Max}, {EltwiseLayer::Min, FusedEltwiseOpType::Min},
+                    {EltwiseLayer::Sub, FusedEltwiseOpType::Sub}, {EltwiseLayer::Div, FusedEltwiseOpType::Div},
+                    {EltwiseLayer::Squared_diff, FusedEltwiseOpType::SquaredDiff}
+                };
+                auto opType = opTypes.at(dynamic_cast<EltwiseLayer*>(layer.get())->_operation);
+                value = getInput(node->getParentEdgesAtPort(0)[0]);
+                for (size_t port = 1; port < layer->insData.size(); port++)
+                    value = addOp(opType, value, getInput(node->getParentEdgesAtPort(port)[0]));
+                break;
+            }
+            case Activation: {
+                auto* activationNode = dynamic_cast<MKLDNNActivationNode*>(node.get());
+                value = addOp(FusedEltwiseOpType::Activation, getInput(node->getParentEdgeAt(0)), -1,
+                              activationNode->getAlgorithm(), activationNode->getAlpha(), activationNode->getBeta());
+                break;
+            }
+            case Power: {
+                auto* powerLayer = dynamic_cast<PowerLayer*>(layer.get());
+                value = getInput(node->getParentEdgeAt(0));
+                if (powerLayer->scale != 1.f || powerLayer->offset != 0.f)
+                    value = addOp(FusedEltwiseOpType::Activation, value, -1, eltwise_linear, powerLayer->scale, powerLayer->offset);
+                if (powerLayer->power == 2.f)
+                    value = addOp(FusedEltwiseOpType::Activation, value, -1, eltwise_square);
+                else if (powerLayer->power == 0.5f)
+                    value = addOp(FusedEltwiseOpType::Activation, value, -1, eltwise_sqrt);
+                else if (powerLayer->power == -1.f)
+                    value = addOp(FusedEltwiseOpType::Div, getConstant({1.f}, channelAxis), value);
+                break;
+            }
+            case Depthwise: {
+                auto* scshLayer = dynamic_cast<ScaleShiftLayer*>(layer.get());
+                auto toVector = [](const Blob::Ptr& blob) {
+                    const float* data = blob->cbuffer().as<const float*>();
+                    return std::vector<float>(data, data + blob->size());
+                };
+                value = addOp(FusedEltwiseOpType::Mul, getInput(node->getParentEdgeAt(0)),
+                              getConstant(toVector(scshLayer->_weights), channelAxis));
+                if (scshLayer->_biases)
+                    value = addOp(FusedEltwiseOpType::Add, value, getConstant(toVector(scshLayer->_biases), channelAxis));
+                break;
+            }
+            case Quantize: {
+                auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+                const size_t axis = quantizeNode->getAxis();
+                auto isFilledWith = [](const std::vector<float>& data, float filler) {
+                    return std::all_of(data.begin(), data.end(), [&](float v) { return v == filler; });
+                };
+                value = getInput(node->getParentEdgeAt(0));
+                value = addOp(FusedEltwiseOpType::Max, value, getConstant(quantizeNode->getCropLow(), axis));
+                value = addOp(FusedEltwiseOpType::Min, value, getConstant(quantizeNode->getCropHigh(), axis));
+                value = addOp(FusedEltwiseOpType::Mul, value, getConstant(quantizeNode->getInputScale(), axis));
+                value = addOp(FusedEltwiseOpType::Add, value, getConstant(quantizeNode->getInputShift(), axis));
+                value = addOp(FusedEltwiseOpType::Round, value, -1);
+                if (!isFilledWith(quantizeNode->getOutputScale(), 1.f))
+                    value = addOp(FusedEltwiseOpType::Mul, value, getConstant(quantizeNode->getOutputScale(), axis));
+                if (!isFilledWith(quantizeNode->getOutputShift(), 0.f))
+                    value = addOp(FusedEltwiseOpType::Add, value, getConstant(quantizeNode->getOutputShift(), axis));
+                break;
+            }
+            default:
+                return false;
+        }
+        nodeValues[node.get()] = value;
+    }
+
+    if (ops.empty() || nodeValues[sink.get()] != opsOffset + static_cast<int>(ops.size() - 1))
+        return false;
+    if (operands.size() > MAX_FUSED_ELTWISE_INPUTS || ops.size() > MAX_FUSED_ELTWISE_OPS)
+        return false;
+
+    // Operands are broadcasted to the output by numpy rules
+    for (auto& operand : operands) {
+        if (operand.dims.size() > outputDims.size())
+            return false;
+        operand.dims.insert(operand.dims.begin(), outputDims.size() - operand.dims.size(), 1);
+        for (size_t i = 0; i < outputDims.size(); i++) {
+            if (operand.dims[i] != outputDims[i] && operand.dims[i] != 1)
+                return false;
+        }
+    }
+
+    jfp = {};
+    jfp.inputs_num = static_cast<int>(operands.size());
+    jfp.ops_num = static_cast<int>(ops.size());
+    auto remap = [&](int value) {
+        return value >= opsOffset ? value - opsOffset + jfp.inputs_num : value;
+    };
+    for (size_t i = 0; i < ops.size(); i++) {
+        jfp.ops[i] = ops[i];
+        jfp.ops[i].src0 = remap(ops[i].src0);
+        jfp.ops[i].src1 = remap(ops[i].src1);
+    }
+    initRows();
+
+    std::vector<jit_fused_eltwise_regs> regs;
+    if (assignRegisters(jfp, regs) > maxVectorRegisters)
+        return false;
+
+    for (const auto& node : nodes) {
+        if (node != sink)
+            fuseWith(node);
+    }
+    return true;
+}
+
+void MKLDNNFusedEltwiseNode::initRows() {
+    const size_t rank = outputDims.size();
+    auto isBroadcasted = [&](const Operand& operand, size_t split) {
+        return std::all_of(operand.dims.begin() + split, operand.dims.end(), [](size_t dim) { return dim == 1; });
+    };
+    auto isDense = [&](const Operand& operand, size_t split) {
+        return std::equal(operand.dims.begin() + split, operand.dims.end(), outputDims.begin() + split);
+    };
+
+    // The longest rows where each operand is either contiguous or a single value
+    size_t split = 0;
+    while (split < rank && !std::all_of(operands.begin(), operands.end(), [&](const Operand& operand) {
+        return isDense(operand, split) || isBroadcasted(operand, split);
+    })) {
+        split++;
+    }
+
+    rowDims.assign(outputDims.begin(), outputDims.begin() + split);
+    rowSize = std::accumulate(outputDims.begin() + split, outputDims.end(), size_t(1), std::multiplies<size_t>());
+    rowsNum = std::accumulate(rowDims.begin(), rowDims.end(), size_t(1), std::multiplies<size_t>());
+
+    operandRowStrides.clear();
+    for (size_t i = 0; i < operands.size(); i++) {
+        const auto& operand = operands[i];
+        const bool dense = isDense(operand, split);
+        jfp.broadcast[i] = !dense;
+
+        std::vector<size_t> strides(split, 0);
+        size_t stride = dense ? rowSize : 1;
+        for (int d = static_cast<int>(split) - 1; d >= 0; d--) {
+            strides[d] = operand.dims[d] == 1 ? 0 : stride;
+            stride *= operand.dims[d];
+        }
+        operandRowStrides.push_back(strides);
+    }
+}
+
+void MKLDNNFusedEltwiseNode::getSupportedDescriptors() {
+    if (jfp.ops_num == 0)
+        THROW_IE_EXCEPTION << "FusedEltwise node " << getName() << " doesn't have a subgraph to execute";
+    if (getParentEdges().size() != externalInputs.size())
+        THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+}
+
+void MKLDNNFusedEltwiseNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::sse42)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        THROW_IE_EXCEPTION << "FusedEltwise node " << getName() << " requires at least SSE4.2 support";
+    }
+
+    const auto& dstDims = getChildEdgeAt(0)->getDims();
+    auto pushDesc = [&](memory::format format) {
+        InferenceEngine::LayerConfig config;
+        config.dynBatchSupport = false;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            const auto& dims = getParentEdgeAt(i)->getDims();
+            InferenceEngine::DataConfig dataConfig;
+            dataConfig.inPlace = -1;
+            dataConfig.constant = false;
+            dataConfig.desc = MKLDNNMemoryDesc(dims, memory::f32, dims == dstDims ? format : MKLDNNMemory::GetPlainFormat(dims));
+            config.inConfs.push_back(dataConfig);
+        }
+
+        InferenceEngine::DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = MKLDNNMemoryDesc(dstDims, memory::f32, format);
+        config.outConfs.push_back(dataConfig);
+
+        supportedPrimitiveDescriptors.push_back({config, impl_type, format});
+    };
+
+    // Any layout is an array of the same elements when the operands are either full or a single value
+    if (isLayoutAgnostic() && (dstDims.ndims() == 4 || dstDims.ndims() == 5)) {
+        const bool is4D = dstDims.ndims() == 4;
+        if (mayiuse(cpu::avx512_common) && dstDims[1] % 16 == 0)
+            pushDesc(is4D ? memory::nChw16c : memory::nCdhw16c);
+        if (dstDims[1] % 8 == 0)
+            pushDesc(is4D ? memory::nChw8c : memory::nCdhw8c);
+        pushDesc(is4D ? memory::nhwc : memory::ndhwc);
+    }
+    pushDesc(MKLDNNMemory::GetPlainFormat(dstDims));
+}
+
+void MKLDNNFusedEltwiseNode::createPrimitive() {
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        THROW_IE_EXCEPTION << "Destination memory didn't allocate.";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate.";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor is not set.";
+
+    // Short rows are processed as a whole, long ones are split into blocks to load all the threads
+    const size_t nthr = parallel_get_max_threads();
+    blocksNum = rowsNum >= nthr ? 1 : std::max<size_t>(1, std::min(div_up(nthr, rowsNum), rowSize / minBlockSize));
+    blockSize = rnd_up(div_up(rowSize, blocksNum), 16);
+    blocksNum = div_up(rowSize, blockSize);
+
+    if (mayiuse(cpu::avx512_common)) {
+        fused_eltwise_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_fused_eltwise_generic<cpu::avx512_common>>(jfp);
+    } else if (mayiuse(cpu::avx2)) {
+        fused_eltwise_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_fused_eltwise_generic<cpu::avx2>>(jfp);
+    } else if (mayiuse(cpu::sse42)) {
+        fused_eltwise_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_fused_eltwise_generic<cpu::sse42>>(jfp);
+    }
+}
+
+void MKLDNNFusedEltwiseNode::execute(mkldnn::stream strm) {
+    std::vector<const float*> srcs(operands.size());
+    for (size_t i = 0; i < operands.size(); i++) {
+        if (operands[i].port < 0) {
+            srcs[i] = operands[i].constant.data();
+        } else {
+            const auto& srcMem = getParentEdgeAt(operands[i].port)->getMemory();
+            srcs[i] = reinterpret_cast<const float*>(srcMem.GetData()) +
+                      srcMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        }
+    }
+    const auto& dstMem = getChildEdgeAt(0)->getMemory();
+    float* dst = reinterpret_cast<float*>(dstMem.GetData()) + dstMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    parallel_for2d(rowsNum, blocksNum, [&](size_t row, size_t block) {
+        const size_t start = block * blockSize;
+        if (start >= rowSize)
+            return;
+
+        auto arg = jit_fused_eltwise_call_args();
+        for (size_t i = 0; i < operands.size(); i++) {
+            const auto& strides = operandRowStrides[i];
+            size_t offset = jfp.broadcast[i] ? 0 : start;
+            size_t rest = row;
+            for (int d = static_cast<int>(rowDims.size()) - 1; d >= 0; d--) {
+                offset += (rest % rowDims[d]) * strides[d];
+                rest /= rowDims[d];
+            }
+            arg.src[i] = srcs[i] + offset;
+        }
+        arg.dst = dst + row * rowSize + start;
+        arg.work_amount = std::min(blockSize, rowSize - start);
+
+        (*fused_eltwise_kernel)(&arg);
+    });
+}
+
+bool MKLDNNFusedEltwiseNode::created() const {
+    return getType() == FusedEltwise;
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+constexpr int MAX_FUSED_ELTWISE_INPUTS = 8;
+constexpr int MAX_FUSED_ELTWISE_OPS = 32;
+
+enum class FusedEltwiseOpType : int {
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Max,
+    Min,
+    SquaredDiff,
+    Round,
+    Activation
+};
+
+struct jit_fused_eltwise_op {
+    FusedEltwiseOpType type;
+    mkldnn::algorithm alg;
+    float alpha;
+    float beta;
+    // Argument values: inputs are numbered first, then the results of the ops
+    int src0;
+    int src1;
+};
+
+struct jit_fused_eltwise_params {
+    int inputs_num;
+    int ops_num;
+    // The input has one value per row and is broadcasted to all its elements
+    int broadcast[MAX_FUSED_ELTWISE_INPUTS];
+    jit_fused_eltwise_op ops[MAX_FUSED_ELTWISE_OPS];
+};
+
+struct jit_fused_eltwise_call_args {
+    const float *src[MAX_FUSED_ELTWISE_INPUTS];
+    float *dst;
+    size_t work_amount;
+};
+
+struct jit_uni_fused_eltwise_kernel {
+    void (*ker_)(const jit_fused_eltwise_call_args *);
+
+    void operator()(const jit_fused_eltwise_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fused_eltwise_kernel(jit_fused_eltwise_params jfp) : ker_(nullptr), jfp_(jfp) {}
+    virtual ~jit_uni_fused_eltwise_kernel() {}
+
+    jit_fused_eltwise_params jfp_;
+};
+
+/**
+ * Executes a subgraph of elementwise nodes (Eltwise, Activation, Power, ScaleShift and FakeQuantize)
+ * with one output by a single JIT kernel, intermediate values are kept in vector registers.
+ * The node is created by the graph optimizer and can not be created from a layer.
+ */
+class MKLDNNFusedEltwiseNode : public MKLDNNNode {
+public:
+    MKLDNNFusedEltwiseNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNFusedEltwiseNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+    /**
+     * Checks the node can be a part of a fused subgraph
+     */
+    static bool isFusingSupported(const MKLDNNNodePtr& node);
+
+    /**
+     * Compiles the nodes into the program of the kernel. The nodes are sorted topologically,
+     * the last one produces the output and all the other ones are consumed inside of the subgraph.
+     * Returns false if the subgraph doesn't fit into one kernel.
+     */
+    bool setSubgraph(const std::vector<MKLDNNNodePtr>& nodes);
+
+    /**
+     * Parents and their output ports which are connected to the node inputs, in the order of the input ports
+     */
+    const std::vector<std::pair<MKLDNNNodePtr, int>>& getExternalInputs() const {
+        return externalInputs;
+    }
+
+    /**
+     * Checks every operand is either of the output shape or a single value, so the output may have any layout
+     * including the blocked ones. Per-channel operands are supported in the plain layout only.
+     */
+    bool isLayoutAgnostic() const {
+        return rowDims.empty();
+    }
+
+private:
+    struct Operand {
+        // Input port of the node or -1 if the operand is a constant of the node
+        int port = -1;
+        std::vector<float> constant;
+        // Dimensions aligned to the output rank
+        InferenceEngine::SizeVector dims;
+    };
+
+    void initRows();
+
+    std::vector<std::pair<MKLDNNNodePtr, int>> externalInputs;
+    std::vector<Operand> operands;
+    InferenceEngine::SizeVector outputDims;
+
+    jit_fused_eltwise_params jfp = {};
+
+    // The output is processed by rows: the operands are either contiguous or broadcasted inside of a row.
+    // Rows are indexed by the outer output dimensions, long rows are split into blocks for the threads.
+    InferenceEngine::SizeVector rowDims;
+    size_t rowSize = 0;
+    size_t rowsNum = 0;
+    std::vector<std::vector<size_t>> operandRowStrides;
+    size_t blockSize = 0;
+    size_t blocksNum = 0;
+
+    std::shared_ptr<jit_uni_fused_eltwise_kernel> fused_eltwise_kernel;
+};
+
+}  // namespace MKLDNNPlugin
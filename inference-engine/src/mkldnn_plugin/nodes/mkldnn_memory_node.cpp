@@ -52,7 +52,7 @@ void MKLDNNMemoryOutputNode::execute(mkldnn::stream strm)  {
 
 #if defined (COMPILED_CPU_MKLDNN_INPUT_NODE)
 MKLDNNMemoryInputNode::MKLDNNMemoryInputNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
-        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}) {
+        : MKLDNNInputNode(layer, eng, cache), MKLDNNMemoryNode(layer), dataStore(new MKLDNNMemory{eng}), activeStore(dataStore) {
     if (created()) {
         holder = MKLDNNMemoryNodeVirtualEdge::registerInput(this);
     }
@@ -100,11 +100,26 @@ MKLDNNMemoryPtr MKLDNNMemoryInputNode::getStore() {
     return dataStore;
 }
 
+std::string MKLDNNMemoryInputNode::getStateName() const {
+    auto state_name = getName();
+
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = state_name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        state_name = state_name.substr(0, suffix_idx);
+
+    return state_name;
+}
+
+void MKLDNNMemoryInputNode::setActiveStore(const MKLDNNMemoryPtr& store) {
+    activeStore = store ? store : dataStore;
+}
+
 void MKLDNNMemoryInputNode::storeState(const MKLDNNMemory &new_state) {
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*activeStore, new_state);
 }
 
 void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
@@ -112,7 +127,7 @@ void MKLDNNMemoryInputNode::execute(mkldnn::stream strm) {
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(dst_mem, *dataStore);
+    simple_copy(dst_mem, *activeStore);
 }
 
 MKLDNNMemoryNodeVirtualEdge::Holder* MKLDNNMemoryNodeVirtualEdge::registerInput(MKLDNNMemoryInputNode * node) {
@@ -104,8 +104,17 @@ public:
     void setInputNode(MKLDNNNode* node) override {}
     void storeState(const MKLDNNMemory& mem);
     MKLDNNMemoryPtr getStore();
+    std::string getStateName() const;
+
+    /**
+     * @brief Sets the store the node reads the state from and the sibling output node writes it to.
+     * Infer requests with own memory states set their stores before each inference
+     * @param store the store of the request or nullptr to use the store of the node
+     */
+    void setActiveStore(const MKLDNNMemoryPtr& store);
  private:
     MKLDNNMemoryPtr dataStore;
+    MKLDNNMemoryPtr activeStore;
     static Register<MKLDNNMemoryInputNode> reg;
     MKLDNNMemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
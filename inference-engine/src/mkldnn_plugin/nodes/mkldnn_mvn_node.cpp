@@ -13,6 +13,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
@@ -557,31 +558,31 @@ void MKLDNNMVNNode::createPrimitive() {
     jcp.across_channels = across_channels;
 
     if (mayiuse(cpu::avx512_common)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+        mvn_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_kernel_f32<cpu::avx512_common>>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+        mvn_mean_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>(jcp));
+            mvn_variance_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::avx512_common>>(jcp);
         }
     } else if (mayiuse(cpu::avx2)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+        mvn_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_kernel_f32<cpu::avx2>>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+        mvn_mean_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>(jcp));
+            mvn_variance_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::avx2>>(jcp);
         }
     } else if (mayiuse(cpu::sse42)) {
-        mvn_kernel.reset(new jit_uni_mvn_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+        mvn_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_kernel_f32<cpu::sse42>>(jcp, *attr.get());
 
         jcp.normalize_variance = false;
-        mvn_mean_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+        mvn_mean_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>>(jcp);
         if (normalize_variance) {
             jcp.normalize_variance = true;
-            mvn_variance_kernel.reset(new jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>(jcp));
+            mvn_variance_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_mvn_mean_variance_kernel_f32<cpu::sse42>>(jcp);
         }
     }
 }
@@ -6,6 +6,7 @@
 #include "mkldnn_depthwise_node.h"
 #include "mkldnn_activation_node.h"
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include "jit_uni_eltwise.hpp"
@@ -902,14 +903,14 @@ void MKLDNNNormalizeNode::createPrimitive() {
     jcp.w = (dims_size > 3) ? dims[3] : 1lu;
 
     if (mayiuse(cpu::avx512_common)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx512_common>(jcp));
-        normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+        normalize_modulo_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_modulo_kernel_f32<cpu::avx512_common>>(jcp);
+        normalize_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_kernel_f32<cpu::avx512_common>>(jcp, *attr.get());
     } else if (mayiuse(cpu::avx2)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::avx2>(jcp));
-        normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+        normalize_modulo_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_modulo_kernel_f32<cpu::avx2>>(jcp);
+        normalize_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_kernel_f32<cpu::avx2>>(jcp, *attr.get());
     } else if (mayiuse(cpu::sse42)) {
-        normalize_modulo_kernel.reset(new jit_uni_normalize_modulo_kernel_f32<cpu::sse42>(jcp));
-        normalize_kernel.reset(new jit_uni_normalize_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+        normalize_modulo_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_modulo_kernel_f32<cpu::sse42>>(jcp);
+        normalize_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_normalize_kernel_f32<cpu::sse42>>(jcp, *attr.get());
     }
 
     const auto &p = (*attr.get()).post_ops_;
@@ -7,6 +7,7 @@
 #include <string>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
 #include "ie_parallel.hpp"
 #include "jit_generator.hpp"
 #include <algorithm>
@@ -20,6 +21,20 @@ using namespace mkldnn::impl::utils;
 
 #define GET_OFF(field) offsetof(jit_args_permute, field)
 
+namespace MKLDNNPlugin {
+
+void appendKernelKey(std::string& key, const jit_permute_conf_t& jpp) {
+    appendKernelKey(key, jpp.ndims);
+    appendKernelKey(key, jpp.dst_block_dims);
+    appendKernelKey(key, jpp.src_strides);
+    appendKernelKey(key, jpp.dst_strides);
+    appendKernelKey(key, jpp.n);
+    appendKernelKey(key, jpp.data_size);
+    appendKernelKey(key, jpp.supported_dynamic_batch);
+}
+
+}  // namespace MKLDNNPlugin
+
 template <cpu::cpu_isa_t isa>
 struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_permute_kernel_f32)
@@ -345,11 +360,11 @@ void MKLDNNPermuteNode::createPrimitive() {
     jpp.data_size = MKLDNNExtensionUtils::sizeOfDataType(data_type);
 
     if (mayiuse(cpu::avx512_common)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx512_common>(jpp));
+        permute_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_permute_kernel_f32<cpu::avx512_common>>(jpp);
     } else if (mayiuse(cpu::avx2)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::avx2>(jpp));
+        permute_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_permute_kernel_f32<cpu::avx2>>(jpp);
     } else if (mayiuse(cpu::sse42)) {
-        permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::sse42>(jpp));
+        permute_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_permute_kernel_f32<cpu::sse42>>(jpp);
     }
 }
 
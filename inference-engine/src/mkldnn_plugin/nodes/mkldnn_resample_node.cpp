@@ -13,6 +13,7 @@
 #include <vector>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_kernel_cache.h"
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
@@ -411,17 +412,17 @@ void MKLDNNResampleNode::createPrimitive() {
     if (type == "caffe.ResampleParameter.NEAREST") {
         if (mayiuse(cpu::avx512_common)) {
             if (jcp.planar_layout) {
-                resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+                resample_nearest_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_resample_nearest_kernel_f32<cpu::avx2>>(jcp, *attr.get());
                 blk_size = 8;
             } else {
-                resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx512_common>(jcp, *attr.get()));
+                resample_nearest_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_resample_nearest_kernel_f32<cpu::avx512_common>>(jcp, *attr.get());
                 blk_size = 16;
             }
         } else if (mayiuse(cpu::avx2)) {
-            resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::avx2>(jcp, *attr.get()));
+            resample_nearest_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_resample_nearest_kernel_f32<cpu::avx2>>(jcp, *attr.get());
             blk_size = 8;
         } else if (mayiuse(cpu::sse42) && !jcp.planar_layout) {
-            resample_nearest_kernel.reset(new jit_uni_resample_nearest_kernel_f32<cpu::sse42>(jcp, *attr.get()));
+            resample_nearest_kernel = MKLDNNKernelCache::getInstance().findOrCreate<jit_uni_resample_nearest_kernel_f32<cpu::sse42>>(jcp, *attr.get());
             blk_size = 8;
         }
     }
@@ -6,6 +6,7 @@
 #include "desc_iterator.hpp"
 #include <legacy/ie_layers.h>
 #include <legacy/ie_layers_internal.hpp>
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <map>
@@ -49,8 +50,9 @@ static LayerConfig make_plain_config(const CNNLayerPtr &layer) {
 
 class PortIteratorHelper : public PortMapHelper {
 public:
-    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to,
-            bool as_input, const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter) : as_input(as_input) {
+    PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool as_input,
+            const TensorIterator::PortMap &port_map, const mkldnn::engine& eng, int n_iter, int first_iter)
+            : as_input(as_input), first_iter(first_iter) {
         const auto &full_blob = as_input ? from : to;
         const auto &part_blob = !as_input ? from : to;
 
@@ -111,13 +113,14 @@ public:
 
             strm.submit({reorders.begin(), reorders.end()});
         } else {
-            if (as_input ? n_iter == 0 : n_iter == (iter_count - 1))
+            if (as_input ? n_iter == first_iter : n_iter == (iter_count - 1))
                 strm.submit({reorders.begin(), reorders.end()});
         }
     };
 
 private:
     bool as_input;
+    int first_iter;  // the first iteration executed by the body, the copy mode inputs are copied once on it
     ptrdiff_t chunk_stride_in_byte = 0;
     ptrdiff_t chunk_offset_in_byte = 0;
 
@@ -141,6 +144,104 @@ public:
     };
 };
 
+/**
+ * Points the body memory right to the chunk of the outer tensor on every iteration instead of copying it.
+ * All the memory objects of the body sharing the data are redirected together.
+ */
+class PortInPlaceHelper : public PortMapHelper {
+public:
+    PortInPlaceHelper(const MKLDNNMemoryPtr &full_blob, const std::vector<MKLDNNMemoryPtr> &part_blobs,
+            const TensorIterator::PortMap &port_map, int n_iter) {
+        mem_holder.push_back(full_blob->GetPrimitive());
+        for (const auto &part_blob : part_blobs)
+            mem_holder.push_back(part_blob->GetPrimitive());
+        iter_count = n_iter;
+
+        if (port_map.axis != -1) {
+            const auto &part_blob = part_blobs.front();
+            chunk_stride_in_byte = part_blob->GetElementsCount() *
+                    MKLDNNExtensionUtils::sizeOfDataType(part_blob->GetDataType());
+            chunk_offset_in_byte = port_map.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+            chunk_stride_in_byte *= port_map.stride < 0 ? -1 : 1;
+        }
+    }
+
+    void execute(int n_iter, mkldnn::stream strm) override {
+        // the outer memory may be moved to the user blob between the infer calls
+        auto chunk_ptr = static_cast<uint8_t *>(mem_holder[FULL_DATA].get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * n_iter;
+
+        for (size_t i = FULL_DATA + 1; i < mem_holder.size(); i++) {
+            if (mem_holder[i].get_data_handle() != chunk_ptr)
+                mem_holder[i].set_data_handle(chunk_ptr);
+        }
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    const int FULL_DATA = 0;
+};
+
+static bool isDensePlain(const MKLDNNMemoryPtr &mem) {
+    if (!MKLDNNMemory::IsPlainFormat(mem->GetFormat()))
+        return false;
+
+    const auto desc = mem->GetDescriptor().data;
+    const auto &blocking = desc.layout_desc.blocking;
+    if (blocking.offset_padding != 0)
+        return false;
+
+    ptrdiff_t stride = 1;
+    for (int i = desc.ndims - 1; i >= 0; i--) {
+        if (blocking.block_dims[i] != 1 || blocking.padding_dims[i] != desc.dims[i] || blocking.strides[0][i] != stride)
+            return false;
+        stride *= desc.dims[i];
+    }
+    return true;
+}
+
+// The chunk of every iteration is a dense part of the outer tensor with the layout of the body memory
+static bool isChunkInPlace(const MKLDNNMemoryPtr &full_blob, const MKLDNNMemoryPtr &part_blob,
+        const TensorIterator::PortMap &port_map) {
+    if (full_blob->GetDataType() != part_blob->GetDataType() || !isDensePlain(full_blob) || !isDensePlain(part_blob))
+        return false;
+
+    auto full_dims = full_blob->GetDims();
+    if (port_map.axis != -1) {
+        for (int i = 0; i < port_map.axis; i++) {
+            if (full_dims[i] != 1)
+                return false;
+        }
+        full_dims[port_map.axis] = std::abs(port_map.stride);
+    }
+    return full_dims == part_blob->GetDims();
+}
+
+// The memory of the body input can be moved if its consumers neither write to it nor keep it in place
+static bool canMoveInputMemory(const MKLDNNNodePtr &input) {
+    auto data = input->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle();
+    for (size_t i = 0; i < input->getChildEdges().size(); i++) {
+        auto child = input->getChildEdgeAt(i)->getChild();
+        if (child->isConstant() || child->isInplace() || child->getType() == Output ||
+                child->getType() == Concatenation || child->getType() == Split)
+            return false;
+        for (size_t j = 0; j < child->getChildEdges().size(); j++) {
+            if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() == data)
+                return false;
+        }
+    }
+    return true;
+}
+
+// The memory of the body output can be moved if it is written by the only producer and read by nobody else
+static bool canMoveOutputMemory(const MKLDNNNodePtr &output) {
+    auto parent = output->getParentEdgeAt(0)->getParent();
+    return parent->getChildEdges().size() == 1 && !parent->isConstant() && !parent->isInplace() &&
+           parent->getType() != Input;
+}
+
 }  // namespace MKLDNNPlugin
 
 MKLDNNTensorIteratorNode::MKLDNNTensorIteratorNode(InferenceEngine::CNNLayerPtr layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache) :
@@ -153,15 +254,26 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
     n_iter = getNumIteration(*ti);
     MKLDNNGraph::ApplyUnrollPasses(ti->body);
-    sub_graph.CreateGraph(ti->body, ext_mng, weightCache);
+
+    bodies.clear();
+    bodies.emplace_back(new Body());
+    createBody(*bodies.front());
+}
+
+void MKLDNNTensorIteratorNode::createBody(Body &body) {
+    auto *ti = dynamic_cast<class TensorIterator*>(getCnnLayer().get());
+    // Node names of the body are unique only within the body, so the body with its replicas shares
+    // the weights and constants through the scope of this node in the cache of the outer graph
+    MKLDNNWeightsSharing::Ptr bodyWeightsCache = weightCache ? weightCache->scoped(getName()) : nullptr;
+    body.graph.CreateGraph(ti->body, ext_mng, bodyWeightsCache);
 
     // Try to detect inputs and outputs by indexes
     std::map<std::string, MKLDNNNodePtr> in_map, out_map;
-    for (auto node : sub_graph.GetNodes())
+    for (auto node : body.graph.GetNodes())
         if (node->getType() == Input)  // filter by type Input
             in_map[node->getName().substr(3)] = node;  // remove "in_" prefix
 
-    for (auto node : sub_graph.GetOutputNodes())
+    for (auto node : body.graph.GetOutputNodes())
         out_map[node->getName().substr(4)] = node;  // remove "out_" prefix
 
     for (const auto &in_data : ti->body.inputs) {
@@ -169,13 +281,15 @@ void MKLDNNTensorIteratorNode::getSupportedDescriptors() {
 
         auto &in_node = in_map[in_data->getName()];
         auto in_mem = in_node->getChildEdgeAt(0)->getMemoryPtr();
-        input_mem.push_back(in_mem);
+        body.input_mem.push_back(in_mem);
+        body.input_nodes.push_back(in_node);
     }
 
     for (const auto &out_data : ti->body.outputs) {
         auto &out_node = out_map[out_data->getName()];
         auto out_mem = out_node->getParentEdgeAt(0)->getMemoryPtr();
-        output_mem.push_back(out_mem);
+        body.output_mem.push_back(out_mem);
+        body.output_nodes.push_back(out_node);
     }
 }
 
@@ -193,50 +307,117 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
     if (ti == nullptr)
         THROW_IE_EXCEPTION << "Cannot convert to TensorIterator layer.";
 
+    // Iterations of a body without back edges and states are independent, so they are executed
+    // by the replicas of the body in parallel
+    bool independent_iterations = ti->back_edges.empty();
+    for (auto &node : bodies.front()->graph.GetNodes()) {
+        if (node->getType() == MemoryInput || node->getType() == MemoryOutput)
+            independent_iterations = false;
+    }
+
+    const int n_bodies = independent_iterations ? std::max(1, std::min(n_iter, parallel_get_max_threads())) : 1;
+    while (bodies.size() < static_cast<size_t>(n_bodies)) {
+        bodies.emplace_back(new Body());
+        createBody(*bodies.back());
+    }
+    bodies.resize(n_bodies);
+
+    for (int i = 0; i < n_bodies; i++) {
+        splitter(n_iter, n_bodies, i, bodies[i]->first_iter, bodies[i]->last_iter);
+        createPortMappers(*bodies[i]);
+    }
+}
+
+void MKLDNNTensorIteratorNode::createPortMappers(Body &body) {
+    auto ti = dynamic_cast<class TensorIterator*>(getCnnLayer().get());
+
+    body.in_port_mappers.clear();
+    body.out_port_mappers.clear();
+    body.in_place_ports = 0;
+
+    // Memory of the ports written by the back edges or shared by several port maps is always copied. The last
+    // iteration output is written by one replica only, so it is not mapped to the outer memory in parallel mode.
+    std::vector<int> in_uses(body.input_mem.size()), out_uses(body.output_mem.size());
+    for (auto map_rule : ti->input_port_map)
+        in_uses[map_rule.to]++;
+    for (auto map_rule : ti->output_port_map)
+        out_uses[map_rule.to]++;
+    for (auto map_rule : ti->back_edges)
+        in_uses[map_rule.to]++;
+
     for (auto map_rule : ti->input_port_map) {
         auto &extr_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &intr_mem = input_mem[map_rule.to];
-
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (extr_mem, intr_mem, true, map_rule, getEngine(), n_iter));
+        auto &intr_mem = body.input_mem[map_rule.to];
+        const auto &intr_node = body.input_nodes[map_rule.to];
+
+        std::shared_ptr<PortMapHelper> mapper;
+        if (in_uses[map_rule.to] == 1 && isChunkInPlace(extr_mem, intr_mem, map_rule) && canMoveInputMemory(intr_node)) {
+            std::vector<MKLDNNMemoryPtr> intr_mems;
+            for (size_t i = 0; i < intr_node->getChildEdges().size(); i++)
+                intr_mems.push_back(intr_node->getChildEdgeAt(i)->getMemoryPtr());
+            mapper.reset(new PortInPlaceHelper(extr_mem, intr_mems, map_rule, n_iter));
+            body.in_place_ports++;
+        } else {
+            mapper.reset(new PortIteratorHelper(extr_mem, intr_mem, true, map_rule, getEngine(), n_iter, body.first_iter));
+        }
 
-        in_port_mappers.push_back(mapper);
+        body.in_port_mappers.push_back(mapper);
     }
 
     for (auto map_rule : ti->output_port_map) {
         auto &extr_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &intr_mem = output_mem[map_rule.to];
-
-        auto mapper = std::shared_ptr<PortMapHelper>(
-                new PortIteratorHelper (intr_mem, extr_mem, false, map_rule, getEngine(), n_iter));
+        auto &intr_mem = body.output_mem[map_rule.to];
+
+        std::shared_ptr<PortMapHelper> mapper;
+        if (out_uses[map_rule.to] == 1 && (map_rule.axis != -1 || bodies.size() == 1) &&
+                isChunkInPlace(extr_mem, intr_mem, map_rule) && canMoveOutputMemory(body.output_nodes[map_rule.to])) {
+            // the in-place outputs are mapped before the iteration is executed
+            body.in_port_mappers.push_back(std::make_shared<PortInPlaceHelper>(
+                    extr_mem, std::vector<MKLDNNMemoryPtr>{intr_mem}, map_rule, n_iter));
+            body.in_place_ports++;
+            continue;
+        }
+        mapper.reset(new PortIteratorHelper(intr_mem, extr_mem, false, map_rule, getEngine(), n_iter, body.first_iter));
 
-        out_port_mappers.push_back(mapper);
+        body.out_port_mappers.push_back(mapper);
     }
 
     for (auto map_rule : ti->back_edges) {
-        auto from_mem = output_mem[map_rule.from];
-        auto to_mem = input_mem[map_rule.to];
+        auto from_mem = body.output_mem[map_rule.from];
+        auto to_mem = body.input_mem[map_rule.to];
 
         auto mapper = std::shared_ptr<PortMapHelper>(
                 new BackEdgePortHelper(from_mem, to_mem, getEngine(), n_iter));
 
-        out_port_mappers.push_back(mapper);
+        body.out_port_mappers.push_back(mapper);
     }
 }
 
 void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
-    sub_graph.ResetInferCount();
+    if (bodies.size() == 1) {
+        executeBody(*bodies.front(), strm);
+        return;
+    }
+
+    parallel_for(bodies.size(), [&](size_t i) {
+        mkldnn::stream body_strm = mkldnn::stream(stream::kind::eager);
+        executeBody(*bodies[i], body_strm);
+    });
+}
+
+void MKLDNNTensorIteratorNode::executeBody(Body &body, mkldnn::stream strm) {
+    body.graph.ResetInferCount();
 
-    for (int i = 0; i < n_iter; i++) {
+    for (int i = body.first_iter; i < body.last_iter; i++) {
         // copy data to subgraph iteration
-        for (auto &mapper : in_port_mappers)
+        for (auto &mapper : body.in_port_mappers)
             mapper->execute(i, strm);
 
-        sub_graph.Infer();
+        body.graph.Infer();
 
         // copy data from subgraph iteration to outputs
         // or next iteration inputs
-        for (auto &mapper : out_port_mappers)
+        for (auto &mapper : body.out_port_mappers)
             mapper->execute(i, strm);
     }
 }
@@ -35,14 +35,35 @@ public:
     void execute(mkldnn::stream strm) override;
 
     void setExtManager(const MKLDNNExtensionManager::Ptr& extMgr) { ext_mng = extMgr; }
+
+    /** Number of the body replicas which execute the iterations in parallel */
+    size_t getBodyReplicasCount() const { return bodies.size(); }
+    /** Number of the port maps of a body bound to the outer memory without copying */
+    size_t getInPlacePortsCount() const { return bodies.empty() ? 0 : bodies.front()->in_place_ports; }
+
 private:
+    /**
+     * Instance of the body graph with its own memory and port mappers. The bodies without back edges
+     * are replicated, every replica executes the iterations [first_iter, last_iter) in parallel with others.
+     */
+    struct Body {
+        MKLDNNGraph graph;
+        std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
+        std::vector<MKLDNNNodePtr> input_nodes, output_nodes;
+        std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
+        int first_iter = 0;
+        int last_iter = 0;
+        size_t in_place_ports = 0;
+    };
+
+    void createBody(Body &body);
+    void createPortMappers(Body &body);
+    void executeBody(Body &body, mkldnn::stream strm);
+
     int n_iter = 0;
 
     MKLDNNExtensionManager::Ptr ext_mng;
-    MKLDNNGraph sub_graph;
-    std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
-
-    std::vector<std::shared_ptr<PortMapHelper>> in_port_mappers, out_port_mappers;
+    std::vector<std::unique_ptr<Body>> bodies;
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include <algorithm>
 #include <utility>
 #include "ie_parallel.hpp"
+#include "non_max_suppression_imp.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -20,7 +21,7 @@ class NonMaxSuppressionImpl: public ExtLayerBase {
 public:
     explicit NonMaxSuppressionImpl(const CNNLayer* layer) {
         try {
-            if (layer->insData.size() < 2 || layer->insData.size() > 5)
+            if (layer->insData.size() < 2 || layer->insData.size() > 6)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect number of input edges!";
 
             if (layer->outData.size() != 1)
@@ -67,6 +68,14 @@ public:
                     THROW_IE_EXCEPTION << layer->name << " 'score_threshold' should be scalar";
             }
 
+            if (layer->insData.size() > 5) {
+                if (layer->insData[NMS_SOFTNMSSIGMA].lock()->getTensorDesc().getPrecision() != Precision::FP32)
+                    THROW_IE_EXCEPTION << layer->name << " Incorrect 'soft_nms_sigma' input precision. Only FP32 is supported!";
+                SizeVector soft_nms_sigma_dims = layer->insData[NMS_SOFTNMSSIGMA].lock()->getTensorDesc().getDims();
+                if (soft_nms_sigma_dims.size() && soft_nms_sigma_dims[0] != 1)
+                    THROW_IE_EXCEPTION << layer->name << " 'soft_nms_sigma' should be scalar";
+            }
+
             if (layer->outData[0]->getTensorDesc().getPrecision() != Precision::I32)
                 THROW_IE_EXCEPTION << layer->name << " Incorrect 'selected_indices' input precision. Only I32 is supported!";
             SizeVector selected_indices_dims = layer->outData[0]->getTensorDesc().getDims();
@@ -84,50 +93,19 @@ public:
             } else if (layer->insData.size() == 4) {
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
                     DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
-            } else {
+            } else if (layer->insData.size() == 5) {
                 addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
                     DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) }, { DataConfigurator(ConfLayout::PLN) });
+            } else {
+                addConfig(layer, { DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN),
+                    DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN) },
+                    { DataConfigurator(ConfLayout::PLN) });
             }
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-    static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
-        float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-        if (center_point_box) {
-            //  box format: x_center, y_center, width, height
-            yminI = boxesI[1] - boxesI[3] / 2.f;
-            xminI = boxesI[0] - boxesI[2] / 2.f;
-            ymaxI = boxesI[1] + boxesI[3] / 2.f;
-            xmaxI = boxesI[0] + boxesI[2] / 2.f;
-            yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-            xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-            ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-            xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-        } else {
-            //  box format: y1, x1, y2, x2
-            yminI = (std::min)(boxesI[0], boxesI[2]);
-            xminI = (std::min)(boxesI[1], boxesI[3]);
-            ymaxI = (std::max)(boxesI[0], boxesI[2]);
-            xmaxI = (std::max)(boxesI[1], boxesI[3]);
-            yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-            xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-            ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-            xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-        }
-
-        float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-        float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-        if (areaI <= 0.f || areaJ <= 0.f)
-            return 0.f;
-
-        float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-        return intersection_area / (areaI + areaJ - intersection_area);
-    }
-
     typedef struct {
         float score;
         int batch_index;
@@ -135,6 +113,19 @@ public:
         int box_index;
     } filteredBoxes;
 
+    struct Candidate {
+        float score;
+        int box_index;
+        int suppress_begin_index;
+    };
+
+    struct Params {
+        int max_output_boxes_per_class;
+        float iou_threshold;
+        float score_threshold;
+        float soft_nms_sigma;
+    };
+
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
         float *boxes = inputs[NMS_BOXES]->cbuffer().as<float *>() +
             inputs[NMS_BOXES]->getTensorDesc().getBlockingDesc().getOffsetPadding();
@@ -143,21 +134,25 @@ public:
 
         SizeVector scores_dims = inputs[NMS_SCORES]->getTensorDesc().getDims();
         int num_boxes = static_cast<int>(scores_dims[2]);
-        int max_output_boxes_per_class = num_boxes;
-        if (inputs.size() > 2)
-            max_output_boxes_per_class = (std::min)(max_output_boxes_per_class,
+        Params params = { num_boxes, 1.f, 0.f, 0.f };
+        if (inputs.size() > NMS_MAXOUTPUTBOXESPERCLASS)
+            params.max_output_boxes_per_class = (std::min)(params.max_output_boxes_per_class,
                 (inputs[NMS_MAXOUTPUTBOXESPERCLASS]->cbuffer().as<int *>() +
                 inputs[NMS_MAXOUTPUTBOXESPERCLASS]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0]);
 
-        float iou_threshold = 1.f;  //  Value range [0, 1]
-        if (inputs.size() > 3)
-            iou_threshold = (std::min)(iou_threshold, (inputs[NMS_IOUTHRESHOLD]->cbuffer().as<float *>() +
+        //  Value range [0, 1]
+        if (inputs.size() > NMS_IOUTHRESHOLD)
+            params.iou_threshold = (std::min)(params.iou_threshold, (inputs[NMS_IOUTHRESHOLD]->cbuffer().as<float *>() +
                 inputs[NMS_IOUTHRESHOLD]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0]);
 
-        float score_threshold = 0.f;
-        if (inputs.size() > 4)
-            score_threshold = (inputs[NMS_SCORETHRESHOLD]->cbuffer().as<float *>() +
+        if (inputs.size() > NMS_SCORETHRESHOLD)
+            params.score_threshold = (inputs[NMS_SCORETHRESHOLD]->cbuffer().as<float *>() +
                 inputs[NMS_SCORETHRESHOLD]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0];
+
+        if (inputs.size() > NMS_SOFTNMSSIGMA)
+            params.soft_nms_sigma = (inputs[NMS_SOFTNMSSIGMA]->cbuffer().as<float *>() +
+                inputs[NMS_SOFTNMSSIGMA]->getTensorDesc().getBlockingDesc().getOffsetPadding())[0];
+
         int* selected_indices = outputs[0]->cbuffer().as<int *>() +
             outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         SizeVector selected_indices_dims = outputs[0]->getTensorDesc().getDims();
@@ -169,44 +164,28 @@ public:
         // scores shape: {num_batches, num_classes, num_boxes}
         int num_batches = static_cast<int>(scores_dims[0]);
         int num_classes = static_cast<int>(scores_dims[1]);
-        std::vector<filteredBoxes> fb;
 
-        for (int batch = 0; batch < num_batches; batch++) {
-            float *boxesPtr = boxes + batch * boxesStrides[0];
-            for (int class_idx = 0; class_idx < num_classes; class_idx++) {
-                float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
-                std::vector<std::pair<float, int> > scores_vector;
-                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
-                    if (scoresPtr[box_idx] > score_threshold)
-                        scores_vector.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
-                }
-
-                if (scores_vector.size()) {
-                    parallel_sort(scores_vector.begin(), scores_vector.end(),
-                        [](const std::pair<float, int>& l, const std::pair<float, int>& r) { return l.first > r.first; });
-
-                    int io_selection_size = 1;
-                    fb.push_back({ scores_vector[0].first, batch, class_idx, scores_vector[0].second });
-                    for (int box_idx = 1; (box_idx < static_cast<int>(scores_vector.size()) && io_selection_size < max_output_boxes_per_class); box_idx++) {
-                        bool box_is_selected = true;
-                        for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[scores_vector[box_idx].second * 4],
-                                             &boxesPtr[scores_vector[idx].second * 4], center_point_box);
-                            if (iou > iou_threshold) {
-                                box_is_selected = false;
-                                break;
-                            }
-                        }
-
-                        if (box_is_selected) {
-                            scores_vector[io_selection_size] = scores_vector[box_idx];
-                            io_selection_size++;
-                            fb.push_back({ scores_vector[box_idx].first, batch, class_idx, scores_vector[box_idx].second });
-                        }
-                    }
-                }
+        // boxes of a batch are decoded once for all the classes: ymin, xmin, ymax, xmax and area planes
+        std::vector<float> decoded(static_cast<size_t>(num_batches) * 5 * num_boxes);
+        parallel_for2d(num_batches, num_boxes, [&](int batch, int box_idx) {
+            decodeBox(boxes + batch * boxesStrides[0] + box_idx * 4, &decoded[batch * 5 * num_boxes], box_idx, num_boxes);
+        });
+
+        // (batch, class) pairs are independent, results are joined in the same order
+        std::vector<std::vector<filteredBoxes>> classBoxes(num_batches * num_classes);
+        parallel_for2d(num_batches, num_classes, [&](int batch, int class_idx) {
+            const float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            auto& fb = classBoxes[batch * num_classes + class_idx];
+            suppress(&decoded[batch * 5 * num_boxes], scoresPtr, num_boxes, params, fb);
+            for (auto& box : fb) {
+                box.batch_index = batch;
+                box.class_index = class_idx;
             }
-        }
+        });
+
+        std::vector<filteredBoxes> fb;
+        for (const auto& boxesOfClass : classBoxes)
+            fb.insert(fb.end(), boxesOfClass.begin(), boxesOfClass.end());
 
         if (sort_result_descending) {
             parallel_sort(fb.begin(), fb.end(), [](const filteredBoxes& l, const filteredBoxes& r) { return l.score > r.score; });
@@ -232,11 +211,112 @@ public:
     }
 
 private:
+    void decodeBox(const float* box, float* decoded, int box_idx, int num_boxes) const {
+        float ymin, xmin, ymax, xmax;
+        if (center_point_box) {
+            //  box format: x_center, y_center, width, height
+            ymin = box[1] - box[3] / 2.f;
+            xmin = box[0] - box[2] / 2.f;
+            ymax = box[1] + box[3] / 2.f;
+            xmax = box[0] + box[2] / 2.f;
+        } else {
+            //  box format: y1, x1, y2, x2
+            ymin = (std::min)(box[0], box[2]);
+            xmin = (std::min)(box[1], box[3]);
+            ymax = (std::max)(box[0], box[2]);
+            xmax = (std::max)(box[1], box[3]);
+        }
+        decoded[0 * num_boxes + box_idx] = ymin;
+        decoded[1 * num_boxes + box_idx] = xmin;
+        decoded[2 * num_boxes + box_idx] = ymax;
+        decoded[3 * num_boxes + box_idx] = xmax;
+        decoded[4 * num_boxes + box_idx] = (ymax - ymin) * (xmax - xmin);
+    }
+
+    // Selects boxes of one class. Candidates are taken from a heap, so only the examined ones are ordered,
+    // and IoU with the selected boxes is computed by blocks starting from the latest selected box.
+    // With soft_nms_sigma > 0 the scores of overlapping boxes decay by exp(-0.5 * iou^2 / sigma) instead.
+    static void suppress(const float* decoded, const float* scoresPtr, int num_boxes, const Params& params,
+                         std::vector<filteredBoxes>& fb) {
+        auto less = [](const Candidate& l, const Candidate& r) {
+            return l.score < r.score || (l.score == r.score && l.box_index > r.box_index);
+        };
+        std::vector<Candidate> candidates;
+        for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+            if (scoresPtr[box_idx] > params.score_threshold)
+                candidates.push_back({ scoresPtr[box_idx], box_idx, 0 });
+        }
+        if (candidates.empty() || params.max_output_boxes_per_class <= 0)
+            return;
+        std::make_heap(candidates.begin(), candidates.end(), less);
+
+        const int max_selected = (std::min)(params.max_output_boxes_per_class, static_cast<int>(candidates.size()));
+        std::vector<float> selected(5 * max_selected);
+        std::vector<float> iou(max_selected);
+        int num_selected = 0;
+        const nms_boxes all = { decoded, decoded + num_boxes, decoded + 2 * num_boxes, decoded + 3 * num_boxes,
+                                decoded + 4 * num_boxes };
+        auto selectedFrom = [&](int first) -> nms_boxes {
+            return { &selected[first], &selected[max_selected + first], &selected[2 * max_selected + first],
+                     &selected[3 * max_selected + first], &selected[4 * max_selected + first] };
+        };
+        const float scale = params.soft_nms_sigma > 0.f ? -0.5f / params.soft_nms_sigma : 0.f;
+        const int block = 64;
+
+        while (!candidates.empty() && num_selected < max_selected) {
+            std::pop_heap(candidates.begin(), candidates.end(), less);
+            Candidate candidate = candidates.back();
+            candidates.pop_back();
+
+            const int b = candidate.box_index;
+            const float box[5] = { all.ymin[b], all.xmin[b], all.ymax[b], all.xmax[b], all.area[b] };
+            const float original_score = candidate.score;
+            bool suppressed = false;
+            if (scale == 0.f) {
+                for (int end = num_selected; end > 0 && !suppressed; end -= block) {
+                    const int first = (std::max)(0, end - block);
+                    XARCH::nms_iou(box, selectedFrom(first), end - first, iou.data());
+                    suppressed = std::any_of(iou.begin(), iou.begin() + (end - first),
+                                             [&](float value) { return value > params.iou_threshold; });
+                }
+            } else {
+                const int first = candidate.suppress_begin_index;
+                XARCH::nms_iou(box, selectedFrom(first), num_selected - first, iou.data());
+                for (int j = num_selected - first - 1; j >= 0; j--) {
+                    if (iou[j] >= params.iou_threshold) {
+                        suppressed = true;
+                        break;
+                    }
+                    candidate.score *= std::exp(scale * iou[j] * iou[j]);
+                    if (candidate.score <= params.score_threshold)
+                        break;
+                }
+                candidate.suppress_begin_index = num_selected;
+                if (!suppressed && candidate.score != original_score) {
+                    // decayed candidate competes with the rest again
+                    if (candidate.score > params.score_threshold) {
+                        candidates.push_back(candidate);
+                        std::push_heap(candidates.begin(), candidates.end(), less);
+                    }
+                    continue;
+                }
+            }
+
+            if (!suppressed) {
+                for (int k = 0; k < 5; k++)
+                    selected[k * max_selected + num_selected] = box[k];
+                num_selected++;
+                fb.push_back({ candidate.score, 0, 0, b });
+            }
+        }
+    }
+
     const size_t NMS_BOXES = 0;
     const size_t NMS_SCORES = 1;
     const size_t NMS_MAXOUTPUTBOXESPERCLASS = 2;
     const size_t NMS_IOUTHRESHOLD = 3;
     const size_t NMS_SCORETHRESHOLD = 4;
+    const size_t NMS_SOFTNMSSIGMA = 5;
     bool center_point_box = false;
     bool sort_result_descending = true;
 };
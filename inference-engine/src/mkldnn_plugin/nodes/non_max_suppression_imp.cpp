@@ -0,0 +1,73 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_max_suppression_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#include "nodes/common/uni_simd.h"
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+void nms_iou(const float box[5], const nms_boxes& boxes, int count, float* iou) {
+    const float areaI = box[4];
+    if (areaI <= 0.f) {
+        std::fill(iou, iou + count, 0.f);
+        return;
+    }
+
+    int first_index = 0;
+#if defined(HAVE_AVX512F)
+    const int block_size = 16;
+#elif defined(HAVE_AVX2)
+    const int block_size = 8;
+#elif defined(HAVE_SSE42)
+    const int block_size = 4;
+#endif
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const auto vzero = _mm_uni_setzero_ps();
+    const auto vyminI = _mm_uni_set1_ps(box[0]);
+    const auto vxminI = _mm_uni_set1_ps(box[1]);
+    const auto vymaxI = _mm_uni_set1_ps(box[2]);
+    const auto vxmaxI = _mm_uni_set1_ps(box[3]);
+    const auto vareaI = _mm_uni_set1_ps(areaI);
+    for (; first_index + block_size <= count; first_index += block_size) {
+        const auto vareaJ = _mm_uni_loadu_ps(boxes.area + first_index);
+        const auto vheight = _mm_uni_max_ps(vzero,
+            _mm_uni_sub_ps(_mm_uni_min_ps(vymaxI, _mm_uni_loadu_ps(boxes.ymax + first_index)),
+                           _mm_uni_max_ps(vyminI, _mm_uni_loadu_ps(boxes.ymin + first_index))));
+        const auto vwidth = _mm_uni_max_ps(vzero,
+            _mm_uni_sub_ps(_mm_uni_min_ps(vxmaxI, _mm_uni_loadu_ps(boxes.xmax + first_index)),
+                           _mm_uni_max_ps(vxminI, _mm_uni_loadu_ps(boxes.xmin + first_index))));
+        const auto vintersection = _mm_uni_mul_ps(vheight, vwidth);
+        const auto vunion = _mm_uni_sub_ps(_mm_uni_add_ps(vareaI, vareaJ), vintersection);
+        // boxes with non-positive area do not overlap anything
+        const auto vvalid = _mm_uni_cmpgt_ps(vareaJ, vzero);
+        _mm_uni_storeu_ps(iou + first_index, _mm_uni_blendv_ps(vzero, _mm_uni_div_ps(vintersection, vunion), vvalid));
+    }
+#endif
+
+    for (int j = first_index; j < count; j++) {
+        const float areaJ = boxes.area[j];
+        if (areaJ <= 0.f) {
+            iou[j] = 0.f;
+            continue;
+        }
+        const float intersection =
+            (std::max)((std::min)(box[2], boxes.ymax[j]) - (std::max)(box[0], boxes.ymin[j]), 0.f) *
+            (std::max)((std::min)(box[3], boxes.xmax[j]) - (std::max)(box[1], boxes.xmin[j]), 0.f);
+        iou[j] = intersection / (areaI + areaJ - intersection);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes decoded to corners, one array per coordinate
+struct nms_boxes {
+    const float* ymin;
+    const float* xmin;
+    const float* ymax;
+    const float* xmax;
+    const float* area;
+};
+
+namespace XARCH {
+
+// Computes intersection over union of the box (ymin, xmin, ymax, xmax, area) with the first count boxes
+void nms_iou(const float box[5], const nms_boxes& boxes, int count, float* iou);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,236 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_count_hw.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <ie_parallel.hpp>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace MKLDNNPlugin {
+
+HwPerfValues& HwPerfValues::operator+=(const HwPerfValues& rhs) {
+    timeNs += rhs.timeNs;
+    cycles += rhs.cycles;
+    instructions += rhs.instructions;
+    cacheReferences += rhs.cacheReferences;
+    cacheMisses += rhs.cacheMisses;
+    return *this;
+}
+
+HwPerfValues HwPerfValues::operator-(const HwPerfValues& rhs) const {
+    auto diff = [](uint64_t a, uint64_t b) { return a > b ? a - b : 0; };
+    HwPerfValues result;
+    result.timeNs = diff(timeNs, rhs.timeNs);
+    result.cycles = diff(cycles, rhs.cycles);
+    result.instructions = diff(instructions, rhs.instructions);
+    result.cacheReferences = diff(cacheReferences, rhs.cacheReferences);
+    result.cacheMisses = diff(cacheMisses, rhs.cacheMisses);
+    return result;
+}
+
+namespace {
+
+uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+#if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
+// TBB workers move between the arenas of the streams and the networks, so they are counted inside this arena only
+struct HwPerfCounters::Arena {
+    struct Observer : public tbb::task_scheduler_observer {
+        Observer(tbb::task_arena& arena, HwPerfCounters& counters) :
+            tbb::task_scheduler_observer(arena), _counters(counters) {}
+        void on_scheduler_entry(bool) override {
+            _counters.attachCurrentThread();
+        }
+        void on_scheduler_exit(bool) override {
+            _counters.detachCurrentThread();
+        }
+        HwPerfCounters& _counters;
+    };
+
+    explicit Arena(HwPerfCounters& counters) : observer(arena, counters) {}
+    ~Arena() {
+        observer.observe(false);
+    }
+
+    tbb::task_arena arena;
+    Observer observer;
+};
+
+void HwPerfCounters::execute(const std::function<void()>& function) {
+    // The arena is created by the first inference to take the concurrency of the stream
+    if (!arena->arena.is_active()) {
+        arena->arena.initialize(parallel_get_max_threads());
+        arena->observer.observe(true);
+    }
+    arena->arena.execute([&] {
+        attachCurrentThread();
+        function();
+    });
+    detachCurrentThread();
+}
+#else
+struct HwPerfCounters::Arena {
+    explicit Arena(HwPerfCounters&) {}
+};
+
+void HwPerfCounters::execute(const std::function<void()>& function) {
+    // The threads of the stream may change between inferences, the known ones are enabled again
+    InferenceEngine::parallel_nt_static(0, [&](const int, const int) { attachCurrentThread(); });
+    function();
+    InferenceEngine::parallel_nt_static(0, [&](const int, const int) { detachCurrentThread(); });
+}
+#endif
+
+HwPerfCounters::HwPerfCounters() : arena(new Arena(*this)) {}
+
+void HwPerfCounters::add(HwPerfCount& count, const HwPerfValues& values) {
+    std::lock_guard<std::mutex> lock(countsMutex);
+    count.add(values);
+}
+
+HwPerfCount HwPerfCounters::get(const HwPerfCount& count) const {
+    std::lock_guard<std::mutex> lock(countsMutex);
+    return count;
+}
+
+#ifdef __linux__
+
+namespace {
+
+int openEvent(uint64_t config, int groupFd) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // Kernel events need a privileged perf_event_paranoid level, user space ones are enough for the nodes
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // The group is enabled while the thread works for the graph
+    attr.disabled = groupFd == -1 ? 1 : 0;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, PERF_FLAG_FD_CLOEXEC));
+}
+
+}  // namespace
+
+HwPerfCounters::~HwPerfCounters() {
+    arena.reset();
+    for (auto& thread : threads) {
+        for (auto fd : thread.fds)
+            close(fd);
+    }
+}
+
+HwPerfCounters::ThreadCounters* HwPerfCounters::findCurrentThread() {
+    const long tid = syscall(SYS_gettid);
+    auto thread = std::find_if(threads.begin(), threads.end(), [&](const ThreadCounters& thread) { return thread.tid == tid; });
+    return thread == threads.end() ? nullptr : &*thread;
+}
+
+void HwPerfCounters::attachCurrentThread() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto known = findCurrentThread();
+    if (known != nullptr) {
+        if (!known->fds.empty())
+            ioctl(known->fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return;
+    }
+
+    ThreadCounters thread;
+    thread.tid = syscall(SYS_gettid);
+    auto open = [&](uint64_t config, int& position) {
+        int fd = openEvent(config, thread.fds.empty() ? -1 : thread.fds.front());
+        if (fd < 0)
+            return;
+        position = static_cast<int>(thread.fds.size());
+        thread.fds.push_back(fd);
+    };
+    open(PERF_COUNT_HW_CPU_CYCLES, thread.cycles);
+    open(PERF_COUNT_HW_INSTRUCTIONS, thread.instructions);
+    open(PERF_COUNT_HW_CACHE_REFERENCES, thread.cacheReferences);
+    open(PERF_COUNT_HW_CACHE_MISSES, thread.cacheMisses);
+    if (!thread.fds.empty())
+        ioctl(thread.fds.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    // A thread which failed to open the counters is kept to not retry on every inference
+    threads.push_back(std::move(thread));
+}
+
+void HwPerfCounters::detachCurrentThread() {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto thread = findCurrentThread();
+    if (thread != nullptr && !thread->fds.empty())
+        ioctl(thread->fds.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+}
+
+HwPerfValues HwPerfCounters::read() const {
+    HwPerfValues values;
+    values.timeNs = now();
+    // nr, time_enabled, time_running and the values of the group events
+    uint64_t data[3 + 4];
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& thread : threads) {
+        if (thread.fds.empty())
+            continue;
+        if (::read(thread.fds.front(), data, sizeof(data)) < static_cast<ssize_t>(3 * sizeof(uint64_t)))
+            continue;
+        const uint64_t enabled = data[1], running = data[2];
+        if (running == 0)
+            continue;
+        // The events are multiplexed if there are more of them than hardware counters
+        auto value = [&](int position) {
+            if (position < 0 || static_cast<uint64_t>(position) >= data[0])
+                return uint64_t(0);
+            return running == enabled ? data[3 + position]
+                                      : static_cast<uint64_t>(static_cast<double>(data[3 + position]) * enabled / running);
+        };
+        values.cycles += value(thread.cycles);
+        values.instructions += value(thread.instructions);
+        values.cacheReferences += value(thread.cacheReferences);
+        values.cacheMisses += value(thread.cacheMisses);
+    }
+    return values;
+}
+
+bool HwPerfCounters::available() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return std::any_of(threads.begin(), threads.end(), [](const ThreadCounters& thread) { return !thread.fds.empty(); });
+}
+
+#else
+
+HwPerfCounters::~HwPerfCounters() = default;
+
+void HwPerfCounters::attachCurrentThread() {}
+
+void HwPerfCounters::detachCurrentThread() {}
+
+HwPerfValues HwPerfCounters::read() const {
+    HwPerfValues values;
+    values.timeNs = now();
+    return values;
+}
+
+bool HwPerfCounters::available() const {
+    return false;
+}
+
+#endif
+
+}  // namespace MKLDNNPlugin
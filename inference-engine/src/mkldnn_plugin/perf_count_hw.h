@@ -0,0 +1,125 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+struct HwPerfValues {
+    // Wall clock time of the reading, so the differences of readings have the duration of the measured interval
+    uint64_t timeNs = 0;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t cacheReferences = 0;
+    uint64_t cacheMisses = 0;
+
+    HwPerfValues& operator+=(const HwPerfValues& rhs);
+    // Saturates at zero, the scaled values of multiplexed events are not strictly monotonic
+    HwPerfValues operator-(const HwPerfValues& rhs) const;
+};
+
+class HwPerfCount {
+    HwPerfValues total;
+    uint32_t num = 0;
+
+public:
+    void add(const HwPerfValues& values) {
+        total += values;
+        num++;
+    }
+
+    HwPerfCount& operator+=(const HwPerfCount& rhs) {
+        total += rhs.total;
+        num += rhs.num;
+        return *this;
+    }
+
+    const HwPerfValues& sum() const { return total; }
+    uint32_t count() const { return num; }
+};
+
+/**
+ * User space hardware events (cycles, instructions, last level cache references and misses) of the threads
+ * executing a graph. Every thread opens its own group of Linux perf_event_open counters, a reading is the sum
+ * over all attached threads, so the work of the internal parallel regions of a node is included.
+ * The groups are enabled only while the threads work in the arena of the counters, so the events of the other
+ * streams and networks served by the same threads are not counted.
+ * The counters are not available on other systems or if perf events are not permitted
+ * (see /proc/sys/kernel/perf_event_paranoid).
+ */
+class HwPerfCounters {
+public:
+    HwPerfCounters();
+    HwPerfCounters(const HwPerfCounters&) = delete;
+    HwPerfCounters& operator=(const HwPerfCounters&) = delete;
+    ~HwPerfCounters();
+
+    /**
+     * Executes the function in the arena of the counters with the concurrency of the calling stream. The threads
+     * joining the arena are attached and counted until they leave it.
+     */
+    void execute(const std::function<void()>& function);
+
+    /**
+     * Opens the counters of the calling thread if they are not opened yet and enables them
+     */
+    void attachCurrentThread();
+
+    /**
+     * Disables the counters of the calling thread
+     */
+    void detachCurrentThread();
+
+    HwPerfValues read() const;
+
+    bool available() const;
+
+    /**
+     * The counts are written by the inferences and read by the metric concurrently, so both go through these
+     */
+    void add(HwPerfCount& count, const HwPerfValues& values);
+    HwPerfCount get(const HwPerfCount& count) const;
+
+private:
+    struct ThreadCounters {
+        long tid;
+        std::vector<int> fds;
+        // Positions of the values in a group reading, -1 for events failed to open
+        int cycles = -1;
+        int instructions = -1;
+        int cacheReferences = -1;
+        int cacheMisses = -1;
+    };
+    struct Arena;
+
+    ThreadCounters* findCurrentThread();
+
+    mutable std::mutex mutex;
+    std::vector<ThreadCounters> threads;
+    mutable std::mutex countsMutex;
+    std::unique_ptr<Arena> arena;
+};
+
+class HwPerfHelper {
+    HwPerfCounters* counters;
+    HwPerfCount& counter;
+    HwPerfValues start;
+
+public:
+    HwPerfHelper(HwPerfCounters* counters, HwPerfCount& count): counters(counters), counter(count) {
+        if (counters) start = counters->read();
+    }
+
+    ~HwPerfHelper() {
+        if (counters) counters->add(counter, counters->read() - start);
+    }
+};
+
+}  // namespace MKLDNNPlugin
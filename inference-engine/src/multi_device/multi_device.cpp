@@ -6,6 +6,8 @@
 #include <string>
 #include <vector>
 #include <iostream>
+#include <limits>
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <map>
@@ -148,8 +150,18 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _devicePriorities{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _loadTime{Time::now()} {
     _taskExecutor.reset();
+    auto policy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != _config.end()) {
+        auto value = policy->second.as<std::string>();
+        if (value == MultiDeviceConfigParams::MULTI_EARLIEST_COMPLETION) {
+            _earliestCompletion = true;
+        } else if (value != MultiDeviceConfigParams::MULTI_PRIORITY) {
+            THROW_IE_EXCEPTION << "Unsupported " << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << " value: " << value;
+        }
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -168,6 +180,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             itNumRequests->second.numRequestsPerDevices == -1) ? optimalNum : itNumRequests->second.numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        _deviceStatistics[device];
         workerRequests.resize(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         for (auto&& workerRequest : workerRequests) {
@@ -177,6 +190,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                    OnWorkerCompleted(device, workerRequestPtr);
                     workerRequestPtr->_status = status;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -191,11 +205,78 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     }
 }
 
+void MultiDeviceExecutableNetwork::OnWorkerStarted(const DeviceName& device, WorkerInferRequest* workerRequestPtr) {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    workerRequestPtr->_busy = true;
+    workerRequestPtr->_startTime = Time::now();
+    _deviceStatistics[device]._inFlight++;
+}
+
+void MultiDeviceExecutableNetwork::OnWorkerCompleted(const DeviceName& device, WorkerInferRequest* workerRequestPtr) {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    if (!workerRequestPtr->_busy) {
+        return;
+    }
+    const double latency = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+        Time::now() - workerRequestPtr->_startTime).count();
+    auto& statistics = _deviceStatistics[device];
+    // exponential moving average follows the changes of the device load
+    const double alpha = 0.125;
+    statistics._latency = statistics._completed == 0 ? latency : (1 - alpha) * statistics._latency + alpha * latency;
+    statistics._completed++;
+    statistics._busyTime += latency;
+    statistics._inFlight--;
+    workerRequestPtr->_busy = false;
+}
+
+DeviceName MultiDeviceExecutableNetwork::GetEarliestCompletionDevice(const DeviceMap<DeviceInformation>& devices) const {
+    std::lock_guard<std::mutex> lock(_statisticsMutex);
+    const auto now = Time::now();
+    DeviceName bestDevice;
+    double bestCompletion = std::numeric_limits<double>::max();
+    for (auto&& device : devices) {
+        auto itStatistics = _deviceStatistics.find(device.first);
+        auto itWorkers = _workerRequests.find(device.first);
+        if (itStatistics == _deviceStatistics.end() || itWorkers == _workerRequests.end() || itWorkers->second.empty()) {
+            continue;
+        }
+        // a device without measurements yet is tried first
+        const auto& statistics = itStatistics->second;
+        double completion = statistics._latency;
+        if (statistics._inFlight >= itWorkers->second.size()) {
+            // all the requests are busy: wait for the one which is expected to finish first
+            double wait = std::numeric_limits<double>::max();
+            for (auto&& workerRequest : itWorkers->second) {
+                if (workerRequest._busy) {
+                    const double elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+                        now - workerRequest._startTime).count();
+                    wait = (std::min)(wait, (std::max)(0.0, statistics._latency - elapsed));
+                }
+            }
+            completion += wait;
+        }
+        if (completion < bestCompletion) {
+            bestCompletion = completion;
+            bestDevice = device.first;
+        }
+    }
+    return bestDevice;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (_earliestCompletion && !devices.empty()) {
+        // the request is left in the queue if the best device is busy, its next completion schedules it
+        auto bestDevice = GetEarliestCompletionDevice(devices);
+        auto itDevice = devices.find(bestDevice);
+        if (itDevice == devices.end()) {
+            return;
+        }
+        devices = {*itDevice};
+    }
     for (auto&& device : devices) {
         auto& idleWorkerRequests = _idleWorkerRequests[device.first];
         WorkerInferRequest* workerRequestPtr = nullptr;
@@ -204,6 +285,7 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
             Task inferPipelineTask;
             if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
                 _thisWorkerInferRequest = workerRequestPtr;
+                OnWorkerStarted(device.first, workerRequestPtr);
                 inferPipelineTask();
                 idleGuard.Release();
                 break;
@@ -311,15 +393,44 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
         IE_ASSERT(it != _networksPerDevice.end());
         result = IE_SET_METRIC(NETWORK_NAME, it->second.GetMetric(
             METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(MULTI_DEVICE_QUEUE_DEPTH)) {
+        std::map<std::string, unsigned int> queueDepth;
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        for (auto&& statistics : _deviceStatistics) {
+            queueDepth[statistics.first] = statistics.second._inFlight;
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_QUEUE_DEPTH, queueDepth);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_UTILIZATION)) {
+        std::map<std::string, float> utilization;
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        const double elapsed = std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(
+            Time::now() - _loadTime).count();
+        for (auto&& statistics : _deviceStatistics) {
+            const auto numRequests = _workerRequests.at(statistics.first).size();
+            utilization[statistics.first] = (elapsed > 0 && numRequests > 0) ?
+                static_cast<float>((std::min)(1.0, statistics.second._busyTime / (elapsed * numRequests))) : 0.f;
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_UTILIZATION, utilization);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_LATENCY)) {
+        std::map<std::string, float> latency;
+        std::lock_guard<std::mutex> lock(_statisticsMutex);
+        for (auto&& statistics : _deviceStatistics) {
+            latency[statistics.first] = static_cast<float>(statistics.second._latency / 1000.0);
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_LATENCY, latency);
     } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
         result = IE_SET_METRIC(SUPPORTED_METRICS, {
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_QUEUE_DEPTH),
+            METRIC_KEY(MULTI_DEVICE_UTILIZATION),
+            METRIC_KEY(MULTI_DEVICE_LATENCY)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
@@ -419,6 +530,9 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(PRIORITY)} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -451,6 +565,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -475,6 +590,10 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        multiNetworkConfig.insert(*policy);
+    }
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -91,12 +92,22 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    using Time = std::chrono::steady_clock;
     struct WorkerInferRequest {
         InferenceEngine::InferRequest   _inferRequest;
         Task                            _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        // guarded by _statisticsMutex
+        bool                            _busy = false;
+        Time::time_point                _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
+    struct DeviceStatistics {
+        unsigned int    _inFlight = 0;
+        uint64_t        _completed = 0;
+        double          _latency = 0.0;   // rolling average, microseconds
+        double          _busyTime = 0.0;  // total of all the worker requests, microseconds
+    };
 
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const DeviceMap<DeviceInformation>&                                        networkDevices,
@@ -113,6 +124,9 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest();
+    DeviceName GetEarliestCompletionDevice(const DeviceMap<DeviceInformation>& devices) const;
+    void OnWorkerStarted(const DeviceName& device, WorkerInferRequest* workerRequestPtr);
+    void OnWorkerCompleted(const DeviceName& device, WorkerInferRequest* workerRequestPtr);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
@@ -124,6 +138,10 @@ public:
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
+    bool                                                        _earliestCompletion = false;
+    mutable std::mutex                                          _statisticsMutex;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    Time::time_point                                            _loadTime;
 };
 
 class MultiDeviceAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
@@ -11,6 +11,7 @@
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_internal.hpp>
 #include <cpp_interfaces/exception2status.hpp>
 #include <ie_system_conf.h>
+#include <ie_tracer.hpp>
 
 #include <exception>
 #include <future>
@@ -181,6 +182,9 @@ protected:
         }();
 
         if (!stop) {
+            if (Tracer::isEnabled()) {
+                Tracer::asyncBegin("request", "infer request", reinterpret_cast<std::uintptr_t>(this), Tracer::now());
+            }
             try {
                 auto& firstStageExecutor = std::get<Stage_e::executor>(*itBeginStage);
                 IE_ASSERT(nullptr != firstStageExecutor);
@@ -283,6 +287,10 @@ protected:
         _syncRequest->SetBatch(batch);
     }
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() override {
+        return _syncRequest->QueryState();
+    }
+
 private:
     /**
      * @brief Create a task with next pipeline stage.
@@ -324,11 +332,15 @@ private:
 
             if ((itEndStage == itNextStage) || (nullptr != localCurrentException)) {
                 auto lastStageTask = [this, requestStatus, localCurrentException]() mutable {
+                    if (Tracer::isEnabled()) {
+                        Tracer::asyncEnd("request", "infer request", reinterpret_cast<std::uintptr_t>(this), Tracer::now());
+                    }
                     auto promise = std::move(_promise);
                     auto callback = _callback.load();
                     if (setIsRequestBusy(false)) {
                         if (nullptr != callback) {
                             InferenceEngine::CurrentException() = localCurrentException;
+                            TraceScope traceScope("callback", "completion callback");
                             try {
                                 callback(_publicInterface, requestStatus);
                             } catch (...) {
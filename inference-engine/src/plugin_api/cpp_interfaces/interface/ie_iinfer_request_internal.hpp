@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
 #include <ie_blob.h>
 #include <ie_common.h>
 #include <ie_preprocess.hpp>
@@ -11,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -83,6 +85,12 @@ public:
      * @param batch - new batch size to be used by all the following inference calls for this request.
      */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+     * @brief Queries memory states owned by the request.
+     * @return Returns memory states
+     */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
 };
 
 }  // namespace InferenceEngine
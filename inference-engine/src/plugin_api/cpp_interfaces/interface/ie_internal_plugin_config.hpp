@@ -44,6 +44,20 @@ DECLARE_CONFIG_KEY(SUBNETWORK_WITH_NETWORK_INPUTS);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Defines an algorithm of CPU memory planning for intermediate tensors:
+ *        GREEDY, BEST_FIT, INTERVAL_COLORING, OPTIMAL or AUTO (default, the best of them)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_MEMORY_PLANNER);
+
+/**
+ * @brief Defines how CPU primitive descriptors and memory layouts are selected:
+ *        GREEDY (default, node by node) or GLOBAL (minimizing the reorders over the whole graph)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_ASSIGNMENT);
+
 /**
  * @brief This key should be used to notify aggregating plugin
  *        that it is used inside other aggregating plugin
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @file ie_tracer.hpp
+ * @brief A lightweight built-in tracer which writes inference timelines in Chrome trace_event JSON format
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Process wide tracer of inference stages: waits in the executor queues, preprocessing, execution of
+ *        the graph nodes and callbacks.
+ *
+ * Every thread records the events to its own ring buffer without locks, so only the latest events of a thread
+ * are kept. The tracer is switched on and off at runtime with the TRACE_FILE Core config key, the events are
+ * written to the file when it is switched off or the Core is destroyed. The file can be opened with
+ * chrome://tracing or https://ui.perfetto.dev.
+ * @ingroup ie_dev_profiling
+ */
+class INFERENCE_ENGINE_API_CLASS(Tracer) {
+public:
+    /**
+     * @brief Drops the recorded events and starts tracing. A running tracing is stopped first, so its events are
+     *        written to its file.
+     * @param path A file the events are written to by Tracer::stop
+     * @param eventsPerThread A capacity of the ring buffer of a thread
+     */
+    static void start(const std::string& path, std::size_t eventsPerThread = 1 << 15);
+
+    /**
+     * @brief Stops tracing and writes the recorded events to the file passed to Tracer::start
+     */
+    static void stop();
+
+    /**
+     * @brief Writes the recorded events as Chrome trace_event JSON
+     * @param out An output stream
+     */
+    static void write(std::ostream& out);
+
+    /**
+     * @brief Checks whether the events are recorded, it is cheap enough to be called on every event
+     * @return `true` if tracing is started
+     */
+    static bool isEnabled() noexcept;
+
+    /**
+     * @brief A monotonic time in nanoseconds the events are measured with
+     * @return The current time
+     */
+    static std::uint64_t now() noexcept;
+
+    /**
+     * @brief Records an interval executed by the calling thread, the intervals of a thread must be nested
+     * @param category A category, must be a string literal
+     * @param name A name, the first characters are copied
+     * @param beginNs A start time, see Tracer::now
+     * @param endNs A finish time
+     */
+    static void complete(const char* category, const char* name, std::uint64_t beginNs, std::uint64_t endNs) noexcept;
+
+    /**
+     * @brief Records the start of an asynchronous interval, which may be finished by another thread
+     * @param category A category, must be a string literal
+     * @param name A name, must be the same for the start and the finish
+     * @param id An identifier which matches the start and the finish
+     * @param timeNs A start time, see Tracer::now
+     */
+    static void asyncBegin(const char* category, const char* name, std::uint64_t id, std::uint64_t timeNs) noexcept;
+
+    /**
+     * @brief Records the finish of an asynchronous interval started by Tracer::asyncBegin
+     */
+    static void asyncEnd(const char* category, const char* name, std::uint64_t id, std::uint64_t timeNs) noexcept;
+
+    /**
+     * @brief Sets a name of the calling thread shown in the timeline
+     * @param name A thread name
+     */
+    static void threadName(const std::string& name);
+};
+
+/**
+ * @brief Records the lifetime of the scope as a Tracer::complete interval if tracing is enabled
+ * @ingroup ie_dev_profiling
+ */
+class TraceScope {
+public:
+    /**
+     * @param category A category, must be a string literal
+     * @param name A name, must be valid until the end of the scope
+     */
+    TraceScope(const char* category, const char* name) noexcept
+        : _category(category), _name(name), _begin(Tracer::isEnabled() ? Tracer::now() : 0) {}
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope() {
+        if (0 != _begin) {
+            Tracer::complete(_category, _name, _begin, Tracer::now());
+        }
+    }
+
+private:
+    const char* _category;
+    const char* _name;
+    std::uint64_t _begin;
+};
+
+}  // namespace InferenceEngine
@@ -199,6 +199,14 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], float mean, float scale, int length);
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length);
+
+void normalizeRow_8UBF16(const uint8_t in[], uint16_t out[], float mean, float scale, int length);
+
+void normalizeRow_32FBF16(const float in[], uint16_t out[], float mean, float scale, int length);
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -3,6 +3,7 @@
 //
 
 #include "ie_preprocess_gapi.hpp"
+#include "ie_preprocess_gapi_kernels_impl.hpp"
 #include "ie_system_conf.h"
 #include "blob_transform.hpp"
 #include "ie_preprocess_data.hpp"
@@ -745,6 +746,33 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
     free(buffer);
 }
 
+// (src - mean[c]) * scale[c] of the planar src written into dst of any 4D layout,
+// dst_t is float for FP32 and uint16_t for BF16
+template <typename src_t, typename dst_t>
+void normalize_planes(const Blob::Ptr& src, Blob::Ptr& dst, const std::vector<float>& mean,
+                      const std::vector<float>& scale) {
+    const auto& dstDesc = dst->getTensorDesc();
+    const auto& dims = dstDesc.getDims();
+    const size_t planeSize = dims[2] * dims[3];
+    const auto srcPtr = src->cbuffer().as<const src_t*>();
+    auto dstPtr = dst->buffer().as<dst_t*>();
+    for (size_t i = 0; i < dst->size(); i++) {
+        const size_t c = (i / planeSize) % dims[1];
+        gapi::kernels::storeNormalized(dstPtr[dstDesc.offset(i)],
+            (srcPtr[i] - (mean.empty() ? 0.f : mean[c])) * (scale.empty() ? 1.f : scale[c]));
+    }
+}
+
+template <typename src_t>
+void normalize_planes(const Blob::Ptr& src, Blob::Ptr& dst, const std::vector<float>& mean,
+                      const std::vector<float>& scale) {
+    if (dst->getTensorDesc().getPrecision() == Precision::BF16) {
+        normalize_planes<src_t, uint16_t>(src, dst, mean, scale);
+    } else {
+        normalize_planes<src_t, float>(src, dst, mean, scale);
+    }
+}
+
 }  // namespace Resize
 
 //----------------------------------------------------------------------
@@ -761,6 +789,7 @@ class PreProcessData : public IPreProcessData {
     Blob::Ptr _roiBlob = nullptr;
     Blob::Ptr _tmp1 = nullptr;
     Blob::Ptr _tmp2 = nullptr;
+    Blob::Ptr _tmp3 = nullptr;
 
     /**
      * @brief Pointer-to-implementation (PIMPL) hiding preprocessing implementation details.
@@ -804,13 +833,33 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     auto algorithm = info.getResizeAlgorithm();
     auto fmt = info.getColorFormat();
 
-    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW) {
+    if (_roiBlob == nullptr) {
+        THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
+    }
+
+    // the network's input precision differs from the user's one: mean values and scales are applied
+    // along with the conversion to the network's precision
+    const bool normalize = _roiBlob->getTensorDesc().getPrecision() != outBlob->getTensorDesc().getPrecision();
+
+    if (algorithm == NO_RESIZE && fmt == ColorFormat::RAW && !normalize) {
        THROW_IE_EXCEPTION << "Input pre-processing is called without the pre-processing info set: "
                              "there's nothing to be done";
     }
 
-    if (_roiBlob == nullptr) {
-        THROW_IE_EXCEPTION << "Input pre-processing is called without ROI blob set";
+    std::vector<float> mean, scale;
+    if (normalize) {
+        switch (info.getMeanVariant()) {
+        case MEAN_VALUE:
+            for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+                mean.push_back(info[c]->meanValue);
+                scale.push_back(info[c]->stdScale);
+            }
+            break;
+        case NONE:
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Mean image is not supported in the fused input normalization";
+        }
     }
 
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
@@ -818,7 +867,7 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize, mean, scale)) {
         return;
     }
 
@@ -833,6 +882,25 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
                               "formats.";
     }
 
+    // resize in the ROI precision, then convert and normalize into the network's input blob
+    Blob::Ptr normBlob = outBlob;
+    if (normalize) {
+        if (outBlob->getTensorDesc().getPrecision() != Precision::FP32 &&
+            outBlob->getTensorDesc().getPrecision() != Precision::BF16) {
+            THROW_IE_EXCEPTION << "Input normalization into " << outBlob->getTensorDesc().getPrecision()
+                               << " is not supported";
+        }
+        if (!_tmp3 || _tmp3->size() != outBlob->size()) {
+            if (_roiBlob->getTensorDesc().getPrecision() == Precision::FP32) {
+                _tmp3 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+            } else {
+                _tmp3 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+            }
+            _tmp3->allocate();
+        }
+        outBlob = _tmp3;
+    }
+
     Blob::Ptr res_in, res_out;
     if (_roiBlob->getTensorDesc().getLayout() == NHWC) {
         if (!_tmp1 || _tmp1->size() != _roiBlob->size()) {
@@ -876,6 +944,16 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Reorder after");
         blob_copy(_tmp2, outBlob);
     }
+
+    if (normalize) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Normalize");
+        outBlob = normBlob;
+        if (_tmp3->getTensorDesc().getPrecision() == Precision::U8) {
+            normalize_planes<uint8_t>(_tmp3, outBlob, mean, scale);
+        } else {
+            normalize_planes<float>(_tmp3, outBlob, mean, scale);
+        }
+    }
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
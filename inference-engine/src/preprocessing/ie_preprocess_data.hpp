@@ -48,6 +48,10 @@ public:
 
     /**
      * @brief Executes input pre-processing with a given pre-processing information.
+     *
+     * If outBlob precision differs from the ROI blob one, the per-channel mean values and scales of
+     * the info are applied as well, (x - meanValue) * stdScale, and the result is written in the outBlob
+     * precision (FP32 or BF16). Mean image is not supported in this case.
      * @param outBlob pre-processed output blob to be used for inference.
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
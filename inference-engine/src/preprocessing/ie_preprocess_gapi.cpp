@@ -21,6 +21,7 @@
 #include "ie_preprocess_gapi.hpp"
 #include "ie_preprocess_gapi_kernels.hpp"
 #include "ie_preprocess_itt.hpp"
+#include "ie_tracer.hpp"
 #include "debug.h"
 
 #include "ie_parallel.hpp"
@@ -77,6 +78,7 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     switch (ie_desc.getPrecision()) {
     case Precision::U8:   return CV_8U;
     case Precision::FP32: return CV_32F;
+    case Precision::BF16: return CV_16U;  // bfloat16 bits, produced by the normalization stage only
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
 }
@@ -543,11 +545,29 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
                             ColorFormat output_color_format,
-                            int precision) {
+                            int precision,
+                            int out_precision,
+                            const std::vector<float>& mean,
+                            const std::vector<float>& scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
 
+    // (plane - mean) * scale is fused with the conversion to the output precision, so every
+    // plane is read once after resize and written once in the network's precision
+    const bool normalize = !mean.empty() || out_precision != precision;
+    auto normalizePlanes = [&](std::vector<cv::GMat>& planes) {
+        if (!normalize) {
+            return;
+        }
+        for (size_t i = 0; i < planes.size(); i++) {
+            planes[i] = gapi::Normalize::on(planes[i],
+                                            mean.empty()  ? 0.f : mean[i],
+                                            scale.empty() ? 1.f : scale[i],
+                                            out_precision);
+        }
+    };
+
     std::vector<cv::GMat> inputs;  // 1 element if NHWC, C elements if NCHW
     if (in_layout == NHWC) {
         inputs.resize(1);
@@ -603,6 +623,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        normalizePlanes(planes);
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -646,6 +668,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
+    normalizePlanes(outputs);
+
     // convert to interleaved if NHWC is required as output
     if (out_layout == NHWC) {
         outputs = merge(outputs, out_desc.d.C);
@@ -666,6 +690,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. normalization parameters have changed (kernel parameters are baked into the graph)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -673,13 +698,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -695,7 +722,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -876,8 +903,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const Normalization& norm,
+    bool omp_serial, int batch_size) {
 
     validateBlob(inBlob);
 
@@ -919,7 +946,8 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  norm };
     const Update update = needUpdate(thisCall);
 
     Opt<cv::GComputation> _lastComputation;
@@ -929,6 +957,7 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
         if (Update::REBUILD == update) {
             //  rebuild the graph
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+            TraceScope buildTraceScope("preprocessing", "graph building");
             // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
             auto custom_desc = getGDesc(in_desc, inBlob);
             _lastComputation = cv::util::make_optional(
@@ -939,7 +968,10 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            algorithm,
                            in_fmt,
                            out_fmt,
-                           get_cv_depth(in_desc_ie)));
+                           get_cv_depth(in_desc_ie),
+                           get_cv_depth(out_desc_ie),
+                           std::get<0>(norm),
+                           std::get<1>(norm)));
         }
     }
 
@@ -953,10 +985,18 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 }
 
 bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<float>& mean, const std::vector<float>& scale) {
     if (!useGAPI()) {
         return false;
     }
+    TraceScope traceScope("preprocessing", "PreprocEngine");
+
+    const auto channels = outBlob->getTensorDesc().getDims()[1];
+    if ((!mean.empty() && mean.size() != channels) || (!scale.empty() && scale.size() != channels)) {
+        THROW_IE_EXCEPTION << "Normalization parameters are not set for all " << channels << " channels";
+    }
+    const Normalization norm{mean, scale};
 
     const auto out_fmt = ColorFormat::BGR;  // FIXME: get expected color format from network
 
@@ -976,8 +1016,8 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, norm,
+            omp_serial, batch_size);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -985,8 +1025,8 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, norm,
+            omp_serial, batch_size);
     }
 
     default:
@@ -995,8 +1035,8 @@ bool PreprocEngine::preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob,
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, norm,
+            omp_serial, batch_size);
     }
 }
 }  // namespace InferenceEngine
@@ -23,7 +23,8 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using Normalization = std::tuple<std::vector<float>, std::vector<float>>;  // mean, scale
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
@@ -46,16 +47,22 @@ class PreprocEngine {
 
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const Normalization& norm,
+        bool omp_serial, int batch_size);
 
 public:
     PreprocEngine();
     static bool useGAPI();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
+    /**
+     * @brief Runs resize and color conversion of inBlob into outBlob. If outBlob precision differs from
+     * inBlob one or mean values are given, every channel c is also converted to (x - mean[c]) * scale[c]
+     * in the outBlob precision (FP32 or BF16). Empty mean/scale mean 0/1 for all channels.
+     */
     bool preprocessWithGAPI(Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        const std::vector<float>& mean = {}, const std::vector<float>& scale = {});
 };
 
 }  // namespace InferenceEngine
@@ -437,7 +437,8 @@ GAPI_FLUID_KERNEL(FMerge2, Merge2, false) {
     static void run(const cv::gapi::fluid::View& a,
                     const cv::gapi::fluid::View& b,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 2> : &mergeRow<float, 2>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 2>  :
+                             (a.meta().depth == CV_16U) ? &mergeRow<uint16_t, 2> : &mergeRow<float, 2>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l)}, out.OutLineB(l), a.length());
         }
@@ -451,7 +452,8 @@ GAPI_FLUID_KERNEL(FMerge3, Merge3, false) {
                     const cv::gapi::fluid::View& b,
                     const cv::gapi::fluid::View& c,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 3> : &mergeRow<float, 3>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 3>  :
+                             (a.meta().depth == CV_16U) ? &mergeRow<uint16_t, 3> : &mergeRow<float, 3>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l), c.InLineB(l)}, out.OutLineB(l), a.length());
         }
@@ -466,7 +468,8 @@ GAPI_FLUID_KERNEL(FMerge4, Merge4, false) {
                     const cv::gapi::fluid::View& c,
                     const cv::gapi::fluid::View& d,
                           cv::gapi::fluid::Buffer& out) {
-        const auto rowFunc = (a.meta().depth == CV_8U) ? &mergeRow<uint8_t, 4> : &mergeRow<float, 4>;
+        const auto rowFunc = (a.meta().depth == CV_8U)  ? &mergeRow<uint8_t, 4>  :
+                             (a.meta().depth == CV_16U) ? &mergeRow<uint16_t, 4> : &mergeRow<float, 4>;
         for (int l = 0; l < out.lpi(); l++) {
             rowFunc({a.InLineB(l), b.InLineB(l), c.InLineB(l), d.InLineB(l)}, out.OutLineB(l), a.length());
         }
@@ -2229,6 +2232,145 @@ GAPI_FLUID_KERNEL(FU16toF32, U16toF32, false) {
     }
 };
 
+template<typename SrcT, typename DstT> static
+void normalizeRow(const SrcT in[], DstT out[], float mean, float scale, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, float>::value) {
+            avx512::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<float*>(out),
+                                       mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, float>::value) {
+            avx512::normalizeRow_32F(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out),
+                                     mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, uint16_t>::value) {
+            avx512::normalizeRow_8UBF16(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<uint16_t*>(out),
+                                        mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, uint16_t>::value) {
+            avx512::normalizeRow_32FBF16(reinterpret_cast<const float*>(in), reinterpret_cast<uint16_t*>(out),
+                                         mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, float>::value) {
+            avx::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<float*>(out),
+                                    mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, float>::value) {
+            avx::normalizeRow_32F(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out),
+                                  mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, uint16_t>::value) {
+            avx::normalizeRow_8UBF16(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<uint16_t*>(out),
+                                     mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, uint16_t>::value) {
+            avx::normalizeRow_32FBF16(reinterpret_cast<const float*>(in), reinterpret_cast<uint16_t*>(out),
+                                      mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, float>::value) {
+            normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<float*>(out),
+                               mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, float>::value) {
+            normalizeRow_32F(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out),
+                             mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, uint16_t>::value) {
+            normalizeRow_8UBF16(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<uint16_t*>(out),
+                                mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<SrcT, float>::value && std::is_same<DstT, uint16_t>::value) {
+            normalizeRow_32FBF16(reinterpret_cast<const float*>(in), reinterpret_cast<uint16_t*>(out),
+                                 mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_SSE
+
+#ifdef HAVE_NEON
+    if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, float>::value) {
+        neon::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<float*>(out),
+                                 mean, scale, length);
+        return;
+    }
+
+    if (std::is_same<SrcT, float>::value && std::is_same<DstT, float>::value) {
+        neon::normalizeRow_32F(reinterpret_cast<const float*>(in), reinterpret_cast<float*>(out),
+                               mean, scale, length);
+        return;
+    }
+
+    if (std::is_same<SrcT, uint8_t>::value && std::is_same<DstT, uint16_t>::value) {
+        neon::normalizeRow_8UBF16(reinterpret_cast<const uint8_t*>(in), reinterpret_cast<uint16_t*>(out),
+                                  mean, scale, length);
+        return;
+    }
+
+    if (std::is_same<SrcT, float>::value && std::is_same<DstT, uint16_t>::value) {
+        neon::normalizeRow_32FBF16(reinterpret_cast<const float*>(in), reinterpret_cast<uint16_t*>(out),
+                                   mean, scale, length);
+        return;
+    }
+#endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        storeNormalized(out[x], (in[x] - mean) * scale);
+    }
+}
+
+GAPI_FLUID_KERNEL(FNormalize, Normalize, false) {
+    static const int LPI = 4;
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale, int /*depth*/,
+                    cv::gapi::fluid::Buffer& out) {
+        const auto in_depth = in.meta().depth;
+        const auto out_depth = out.meta().depth;
+        for (int l = 0; l < out.lpi(); l++) {
+            if (in_depth == CV_8U && out_depth == CV_32F) {
+                normalizeRow(in.InLine<uint8_t>(l), out.OutLine<float>(l), mean, scale, in.length());
+            } else if (in_depth == CV_32F && out_depth == CV_32F) {
+                normalizeRow(in.InLine<float>(l), out.OutLine<float>(l), mean, scale, in.length());
+            } else if (in_depth == CV_8U && out_depth == CV_16U) {
+                normalizeRow(in.InLine<uint8_t>(l), out.OutLine<uint16_t>(l), mean, scale, in.length());
+            } else {
+                normalizeRow(in.InLine<float>(l), out.OutLine<uint16_t>(l), mean, scale, in.length());
+            }
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2256,6 +2398,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FU16toF32
+        , FNormalize
         >();
 }
 
@@ -151,6 +151,15 @@ namespace gapi {
         }
     };
 
+    // Per-plane (in - mean) * scale with conversion to CV_32F or to bfloat16 kept in CV_16U
+    G_TYPED_KERNEL(Normalize, <cv::GMat(cv::GMat, float, float, int)>, "com.intel.ie.normalize") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float /*mean*/, float /*scale*/, int depth) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(depth == CV_32F || depth == CV_16U);
+            return in.withDepth(depth);
+        }
+    };
 
 
     cv::gapi::GKernelPackage preprocKernels();
@@ -24,6 +24,7 @@
 
 #include <climits>
 #include <cstdint>
+#include <cstring>
 
 #if defined(__GNUC__) && (__GNUC__ <= 5)
 #include <cmath>
@@ -98,6 +99,18 @@ static inline Q8_8 mulaw(Q0_16 a, Q8_8 w) { return static_cast<Q8_8>((a * w) >>
 static inline float mulas(float a, float s) { return a * s; }
 static inline float mulaw(float a, float w) { return a * w; }
 
+//------------------------------------------------------------------------------
+
+// bfloat16 is kept in uint16_t, the value is rounded to the nearest even
+static inline uint16_t f32_to_bf16(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+static inline void storeNormalized(float& out, float x) { out = x; }
+static inline void storeNormalized(uint16_t& out, float x) { out = f32_to_bf16(x); }
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
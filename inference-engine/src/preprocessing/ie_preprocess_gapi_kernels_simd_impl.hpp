@@ -783,6 +783,55 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+//------------------------------------------------------------------------------
+
+#if MANUAL_SIMD
+inline v_float32 loadNormalizeRow(const uint8_t in[]) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(in)));
+}
+
+inline v_float32 loadNormalizeRow(const float in[]) {
+    return vx_load(in);
+}
+
+inline void storeNormalizeRow(float out[], const v_float32& r) {
+    vx_store(out, r);
+}
+
+inline void storeNormalizeRow(uint16_t out[], const v_float32& r) {
+    // bfloat16 is the upper half of float, rounded to the nearest even
+    v_uint32 bits = v_reinterpret_as_u32(r);
+    bits = bits + vx_setall_u32(0x7FFF) + ((bits >> 16) & vx_setall_u32(1));
+    v_pack_store(out, bits >> 16);
+}
+#endif
+
+// out = (in - mean) * scale, bfloat16 output is kept in uint16_t
+template<typename SrcT, typename DstT>
+inline void normalizeRow_impl(const SrcT in[], DstT out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        storeNormalizeRow(&out[l], (loadNormalizeRow(&in[l]) - vmean) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        storeNormalized(out[l], (in[l] - mean) * scale);
+    }
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -5,6 +5,7 @@
 #include "ie_ir_parser.hpp"
 
 #include <typeinfo>
+#include <cstdint>
 #include <unordered_set>
 #include <algorithm>
 #include <deque>
@@ -22,6 +23,7 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/variant.hpp>
+#include <ngraph/runtime/shared_buffer.hpp>
 
 #include <cpp/ie_cnn_network.h>
 #include "ie_blob_stream.hpp"
@@ -34,6 +36,22 @@
 using namespace InferenceEngine;
 using namespace XMLParseUtils;
 
+namespace {
+
+details::BlobStream* getBlobStream(std::istream& binStream) {
+    details::BlobStream* blobStream = dynamic_cast<details::BlobStream*>(&binStream);
+    if (blobStream == nullptr) {
+        details::BlobStream helper({});
+        std::string typeStream = typeid(binStream).name();
+        std::string typeBlobStream = typeid(helper).name();
+        if (typeStream == typeBlobStream)
+            blobStream = static_cast<details::BlobStream*>(&binStream);
+    }
+    return blobStream;
+}
+
+}  // namespace
+
 IRParser::IRParser(size_t version): IRParser(version, {}) {}
 IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts) {
     switch (version) {
@@ -1523,6 +1541,16 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
+    // Weights are already in memory (e.g. mapped from the bin file): refer to them without copying
+    if (auto blobStream = getBlobStream(binStream)) {
+        auto weights = blobStream->getBlob();
+        char* data = weights->cbuffer().as<char*>() + offset;
+        if (el_type.size() != 0 && reinterpret_cast<std::uintptr_t>(data) % el_type.size() == 0) {
+            auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<Blob::CPtr>>(data, size, weights);
+            return std::make_shared<ngraph::op::Constant>(port.precision, shape, buffer);
+        }
+    }
+
     auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
     char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
     binStream.seekg(offset, std::ios::beg);
@@ -14,6 +14,17 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Returns the index of the extensible array element (std::ios_base::pword) of the model stream which
+ * points to the std::string with the path of the model file. Readers resolve the files the model refers to
+ * relative to the path. The element is nullptr if the model is not read from a file.
+ *
+ * The index is allocated with std::ios_base::xalloc once per process, so it does not collide with the
+ * elements used by other code.
+ * @return The index of the element
+ */
+INFERENCE_ENGINE_API_CPP(int) getModelPathStreamIndex();
+
 /**
  * @brief IReader an abstract interface for Inference Engine readers
  */
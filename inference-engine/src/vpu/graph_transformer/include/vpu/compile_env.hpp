@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include <vpu/graph_transformer.hpp>
 #include <vpu/model/model.hpp>
 #include <vpu/utils/logger.hpp>
@@ -55,6 +57,10 @@ public:
     static void updateConfig(const CompilationConfig& config);
     static void free();
 
+    // Runs body(0) ... body(count - 1) on the Inference Engine threads with the environment of the caller.
+    // The first exception thrown by the body is rethrown after all iterations are finished.
+    static void parallelFor(int count, const std::function<void(int)>& body);
+
 private:
     explicit CompileEnv(Platform platform);
 };
@@ -155,6 +155,9 @@ struct CompiledGraph final {
     std::uint32_t numShaves = 0;
     std::uint32_t numSlices = 0;
     std::uint32_t numExecutors = 0;
+
+    // Middle-end passes durations in milliseconds, in the order of execution
+    std::vector<std::pair<std::string, double>> passesTime;
 };
 
 //
@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <vpu/middleend/hw/tiling.hpp>
+#include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+//
+// Tiling search results are memoized by the stage parameters and the CMX resources of the compilation,
+// so equal stages of one network and of the subsequent compilations in the same process reuse them.
+// The returned tilings are shared between the stages and must not be modified.
+//
+
+struct ConvTilingSolution final {
+    bool tilingPossible = false;
+    bool withPool = false;
+    std::vector<HwConvTilingPtr> hwTilings;
+};
+
+struct PoolTilingSolution final {
+    bool tilingPossible = false;
+    std::vector<HwPoolTilingPtr> hwTilings;
+};
+
+struct TilingCacheStats final {
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+};
+
+// Falls back to the tiling without the fused pooling if the fused one is not possible
+ConvTilingSolution findConvTiling(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions);
+
+PoolTilingSolution findPoolTiling(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions);
+
+TilingCacheStats getTilingCacheStats();
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
@@ -54,7 +54,7 @@ class PassSet final {
 public:
     using Ptr = std::shared_ptr<PassSet>;
 
-    void run(const Model& model) const;
+    void run(const Model& model);
 
     inline void addPass(
             const Pass::Ptr& pass,
@@ -62,8 +62,14 @@ public:
         _passes.emplace_back(pass, name);
     }
 
+    // Durations of the passes of the last run in milliseconds, in the order of execution
+    const std::vector<std::pair<std::string, double>>& passesTime() const {
+        return _passesTime;
+    }
+
 private:
     std::vector<std::pair<Pass::Ptr, std::string>> _passes;
+    std::vector<std::pair<std::string, double>> _passesTime;
 };
 
 //
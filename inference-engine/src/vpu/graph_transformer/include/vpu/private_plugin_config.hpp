@@ -102,6 +102,17 @@ DECLARE_VPU_CONFIG(MYRIAD_PLUGIN_LOG_FILE_PATH);
 
 DECLARE_VPU_CONFIG(MYRIAD_DEVICE_CONNECT_TIMEOUT);
 
+//
+// Private metrics
+//
+
+/**
+ * @brief Executable network metric with the durations of the graph transformer passes.
+ * The value is std::vector<std::pair<std::string, double>> of the pass names and milliseconds in the order
+ * of execution, it is empty for the imported networks.
+ */
+DECLARE_VPU_CONFIG(MYRIAD_PASSES_TIME);
+
 namespace VPUConfigParams {
 
 IE_SUPPRESS_DEPRECATED_START
@@ -25,12 +25,15 @@
 #include <sstream>
 #include <iomanip>
 #include <atomic>
+#include <exception>
+#include <mutex>
 
 #include <precision_utils.h>
 #include <legacy/graph_tools.hpp>
 #include <description_buffer.hpp>
 #include <xml_parse_utils.h>
 #include <legacy/ie_util_internal.hpp>
+#include <ie_parallel.hpp>
 
 #include <vpu/parsed_config.hpp>
 #include <vpu/compile_env.hpp>
@@ -138,6 +141,38 @@ void CompileEnv::free() {
     g_compileEnv = nullptr;
 }
 
+void CompileEnv::parallelFor(int count, const std::function<void(int)>& body) {
+    IE_ASSERT(g_compileEnv != nullptr);
+    IE_ASSERT(g_compileEnv->initialized);
+
+    auto compileEnv = g_compileEnv;
+
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    ie::parallel_for(count, [&](int ind) {
+        // Worker threads may run other compilations in between, so the previous environment is restored
+        auto prevCompileEnv = g_compileEnv;
+        g_compileEnv = compileEnv;
+        AutoScope restoreEnv([prevCompileEnv] {
+            g_compileEnv = prevCompileEnv;
+        });
+
+        try {
+            body(ind);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (exception == nullptr) {
+                exception = std::current_exception();
+            }
+        }
+    });
+
+    if (exception != nullptr) {
+        std::rethrow_exception(exception);
+    }
+}
+
 //
 // compileNetwork
 //
@@ -172,7 +207,10 @@ CompiledGraph::Ptr compileImpl(ie::ICNNNetwork& network,
                           nullptr);
     }
 
-    return backEnd->build(model, frontEnd->origLayers());
+    auto compiledGraph = backEnd->build(model, frontEnd->origLayers());
+    compiledGraph->passesTime = middleEnd->passesTime();
+
+    return compiledGraph;
 }
 
 CompiledGraph::Ptr compileImpl(const Model& model) {
@@ -188,7 +226,10 @@ CompiledGraph::Ptr compileImpl(const Model& model) {
 
     middleEnd->run(model);
 
-    return backEnd->build(model, {});
+    auto compiledGraph = backEnd->build(model, {});
+    compiledGraph->passesTime = middleEnd->passesTime();
+
+    return compiledGraph;
 }
 
 }  // namespace
@@ -0,0 +1,152 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vpu/middleend/hw/tiling_cache.hpp>
+
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
+
+namespace vpu {
+
+namespace HWTilingNS {
+
+namespace {
+
+// The cache is dropped as a whole when it is full, the typical network has much less distinct stages
+constexpr std::size_t maxCacheSize = 4096;
+
+template <class Solution>
+class TilingCache final {
+public:
+    template <class Search>
+    Solution find(const std::string& key, Search&& search) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _solutions.find(key);
+            if (it != _solutions.end()) {
+                ++_stats.hits;
+                return it->second;
+            }
+            ++_stats.misses;
+        }
+
+        // The search is done without the lock, so the stages of one pass can be tiled in parallel
+        auto solution = search();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_solutions.size() >= maxCacheSize) {
+            _solutions.clear();
+        }
+        _solutions.emplace(key, solution);
+
+        return solution;
+    }
+
+    TilingCacheStats stats() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
+private:
+    std::mutex _mutex;
+    std::unordered_map<std::string, Solution> _solutions;
+    TilingCacheStats _stats;
+};
+
+TilingCache<ConvTilingSolution>& convTilingCache() {
+    static TilingCache<ConvTilingSolution> cache;
+    return cache;
+}
+
+TilingCache<PoolTilingSolution>& poolTilingCache() {
+    static TilingCache<PoolTilingSolution> cache;
+    return cache;
+}
+
+// The stage name is the only parameter left out, it is used in the error messages only
+std::string tilingKey(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    const auto& env = CompileEnv::get();
+
+    std::ostringstream key;
+    printTo(key, options._inputDims);
+    printTo(key, options._outputDims);
+    printTo(key, options._origOutputDims);
+    key << options._kernelSizeX << ',' << options._kernelSizeY << ',' << options._kernelStride << ','
+        << options._paddingLeft << ',' << options._paddingRight << ','
+        << options._paddingTop << ',' << options._paddingBottom << ','
+        << options._withPool << ',' << static_cast<int>(direction) << ',' << maxTilingOptions << ','
+        << env.resources.numCMXSlices << ',' << env.resources.tilingCMXLimit;
+
+    return key.str();
+}
+
+}  // namespace
+
+ConvTilingSolution findConvTiling(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    return convTilingCache().find(tilingKey(options, direction, maxTilingOptions), [&] {
+        ConvTilingSolution solution;
+
+        const HWConvolutionTiler tiler1stAttempt(options, direction, maxTilingOptions);
+
+        const HWConvolutionTiler& tiler = [&] {
+            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
+                const auto optionsWithoutPool = ConvolutionOptions{
+                    options._stageName,
+                    options._inputDims,
+                    options._origOutputDims,
+                    options._origOutputDims,
+                    options._kernelSizeX,
+                    options._kernelSizeY,
+                    options._kernelStride,
+                    options._paddingLeft,
+                    options._paddingRight,
+                    options._paddingTop,
+                    options._paddingBottom,
+                    false
+                };
+
+                return HWConvolutionTiler{optionsWithoutPool, direction, maxTilingOptions};
+            } else {
+                return tiler1stAttempt;
+            }
+        }();
+
+        solution.tilingPossible = tiler.isTilingPossible();
+        solution.withPool = tiler.withPool();
+        solution.hwTilings = tiler.getHwTilings();
+
+        return solution;
+    });
+}
+
+PoolTilingSolution findPoolTiling(const ConvolutionOptions& options, Direction direction, std::size_t maxTilingOptions) {
+    return poolTilingCache().find(tilingKey(options, direction, maxTilingOptions), [&] {
+        PoolTilingSolution solution;
+
+        const HWPoolingTiler tiler(options, direction, maxTilingOptions);
+        solution.tilingPossible = tiler.isTilingPossible();
+        solution.hwTilings = tiler.getHwTilings();
+
+        return solution;
+    });
+}
+
+TilingCacheStats getTilingCacheStats() {
+    const auto conv = convTilingCache().stats();
+    const auto pool = poolTilingCache().stats();
+
+    TilingCacheStats stats;
+    stats.hits = conv.hits + pool.hits;
+    stats.misses = conv.misses + pool.misses;
+    return stats;
+}
+
+}  // namespace HWTilingNS
+
+}  // namespace vpu
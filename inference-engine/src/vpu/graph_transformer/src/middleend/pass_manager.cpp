@@ -31,7 +31,7 @@ void PerStagePass::run(const Model& model) {
 // PassSet
 //
 
-void PassSet::run(const Model& model) const {
+void PassSet::run(const Model& model) {
     using MilliSecondsFP64 = std::chrono::duration<double, std::milli>;
 
     const auto& env = CompileEnv::get();
@@ -39,6 +39,9 @@ void PassSet::run(const Model& model) const {
     env.log->debug("MiddleEnd : Run passes");
     VPU_LOGGER_SECTION(env.log);
 
+    _passesTime.clear();
+    _passesTime.reserve(_passes.size());
+
     int passInd = 0;
     for (const auto& p : _passes) {
         env.log->debug("Start pass %m%d / %d [%s]", std::setw(2), passInd + 1, _passes.size(), p.second);
@@ -51,11 +54,13 @@ void PassSet::run(const Model& model) const {
         p.first->run(model);
 
         auto endTime = std::chrono::high_resolution_clock::now();
+        const auto duration = std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count();
 
         env.log->debug(
             "Pass %m%d / %d [%s] duration : %f ms",
-            std::setw(2), passInd + 1, _passes.size(), p.second,
-            std::chrono::duration_cast<MilliSecondsFP64>(endTime - startTime).count());
+            std::setw(2), passInd + 1, _passes.size(), p.second, duration);
+
+        _passesTime.emplace_back(p.second, duration);
 
         ++passInd;
     }
@@ -8,6 +8,7 @@
 #include <utility>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
@@ -16,6 +17,7 @@
 #include <vpu/middleend/hw/utility.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
 
 namespace vpu {
 
@@ -34,6 +36,19 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwConvTiling);
 
+    const auto& env = CompileEnv::get();
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
+                                         // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    //
+    // Collect the stages first, the model is not changed until all the tilings are found
+    //
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubConv) {
             continue;
@@ -47,19 +62,8 @@ void PassImpl::run(const Model& model) {
         const HWConvStageOptions stageOptions(origStage);
         const HWConvStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Unsupported paddings
-        //
-
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction = HWTilingNS::Direction::INPUT_TO_OUTPUT;
-                                             // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        convolutionOptions.push_back(HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -72,39 +76,33 @@ void PassImpl::run(const Model& model) {
             stageOptions.padTop,
             stageOptions.padBottom,
             stageOptions.withPool
-        };
-
-        const HWTilingNS::HWConvolutionTiler tiler1stAttempt(convolutionOptions, direction, tilingsCount);
-
-
-        const HWTilingNS::HWConvolutionTiler& tiler = [&] {
-            if (!tiler1stAttempt.isTilingPossible() && tiler1stAttempt.withPool()) {
-                const auto optionsWithoutPool = HWTilingNS::ConvolutionOptions{
-                    origStage->name(),
-                    stageIO.origInput->desc().dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageIO.origOutputDesc.dims(),
-                    stageOptions.kernelSizeX,
-                    stageOptions.kernelSizeY,
-                    stageOptions.kernelStride,
-                    stageOptions.padLeft,
-                    stageOptions.padRight,
-                    stageOptions.padTop,
-                    stageOptions.padBottom,
-                    false
-                };
-
-                return HWTilingNS::HWConvolutionTiler{optionsWithoutPool, direction, tilingsCount};
-            } else {
-                return tiler1stAttempt;
-            }
-        }();
+        });
+    }
+
+    //
+    // Try to find "best" tiling, the search of every stage is independent
+    //
+
+    std::vector<HWTilingNS::ConvTilingSolution> tilings(hwStages.size());
+    CompileEnv::parallelFor(static_cast<int>(hwStages.size()), [&](int ind) {
+        tilings[ind] = HWTilingNS::findConvTiling(convolutionOptions[ind], direction, tilingsCount);
+    });
+
+    const auto cacheStats = HWTilingNS::getTilingCacheStats();
+    env.log->trace("Tiling cache : %d hits, %d misses", cacheStats.hits, cacheStats.misses);
+
+    for (size_t ind = 0; ind < hwStages.size(); ++ind) {
+        const auto& origStage = hwStages[ind];
+        const auto& tiling = tilings[ind];
+
+        const HWConvStageOptions stageOptions(origStage);
+        const HWConvStageIO stageIO(origStage, origStage->output(0));
 
         //
         // Use SW stage if tiling optimization failed
         //
 
-        if (!tiler.isTilingPossible()) {
+        if (!tiling.tilingPossible) {
             origStage->attrs().set<bool>("tryHW", false);
 
             auto swConvOutput = stageIO.origOutput;
@@ -182,15 +180,15 @@ void PassImpl::run(const Model& model) {
 
         model->disconnectStage(origStage);
 
-        for (const auto &tiling : tiler.getHwTilings()) {
+        for (const auto& hwTiling : tiling.hwTilings) {
             HWConvStageTiler hwStageTiler(
                 stageOptions,
                 stageIO,
                 model,
                 origStage,
                 _stageBuilder,
-                tiling,
-                stageOptions.withPool && !tiler.withPool());
+                hwTiling,
+                stageOptions.withPool && !tiling.withPool);
 
             //
             // Split/concat input/output tiles
@@ -9,11 +9,14 @@
 #include <string>
 #include <utility>
 #include <memory>
+#include <vector>
 
+#include <vpu/compile_env.hpp>
 #include <vpu/stages/stub_stage.hpp>
 #include <vpu/middleend/hw/conv_tiling/hw_convolution_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_pooling_tiler.hpp>
 #include <vpu/middleend/hw/pooling_tiling/hw_stage_tiler.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
 
 namespace vpu {
 
@@ -32,6 +35,20 @@ private:
 void PassImpl::run(const Model& model) {
     VPU_PROFILE(hwPoolTiling);
 
+    const auto& env = CompileEnv::get();
+
+    const size_t tilingsCount = 1;
+    const HWTilingNS::Direction direction =
+            HWTilingNS::Direction::INPUT_TO_OUTPUT;
+    // HWTilingNS::Direction::OUTPUT_TO_INPUT;
+
+    //
+    // Collect the stages first, the model is not changed until all the tilings are found
+    //
+
+    std::vector<Stage> hwStages;
+    std::vector<HWTilingNS::ConvolutionOptions> convolutionOptions;
+
     for (const auto& origStage : model->getStages()) {
         if (origStage->type() != StageType::StubMaxPool &&
             origStage->type() != StageType::StubAvgPool) {
@@ -46,16 +63,8 @@ void PassImpl::run(const Model& model) {
         const HWPoolStageOptions stageOptions(origStage);
         const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        //
-        // Try to find "best" tiling
-        //
-
-        const size_t tilingsCount = 1;
-        const HWTilingNS::Direction direction =
-                HWTilingNS::Direction::INPUT_TO_OUTPUT;
-        // HWTilingNS::Direction::OUTPUT_TO_INPUT;
-
-        const auto convolutionOptions = HWTilingNS::ConvolutionOptions{
+        hwStages.push_back(origStage);
+        convolutionOptions.push_back(HWTilingNS::ConvolutionOptions{
             origStage->name(),
             stageIO.origInput->desc().dims(),
             stageIO.origOutput->desc().dims(),
@@ -67,11 +76,29 @@ void PassImpl::run(const Model& model) {
             stageOptions.padRight,
             stageOptions.padTop,
             stageOptions.padBottom,
-            false};
+            false});
+    }
+
+    //
+    // Try to find "best" tiling, the search of every stage is independent
+    //
+
+    std::vector<HWTilingNS::PoolTilingSolution> tilings(hwStages.size());
+    CompileEnv::parallelFor(static_cast<int>(hwStages.size()), [&](int ind) {
+        tilings[ind] = HWTilingNS::findPoolTiling(convolutionOptions[ind], direction, tilingsCount);
+    });
+
+    const auto cacheStats = HWTilingNS::getTilingCacheStats();
+    env.log->trace("Tiling cache : %d hits, %d misses", cacheStats.hits, cacheStats.misses);
 
-        const HWTilingNS::HWPoolingTiler tiler(convolutionOptions, direction, tilingsCount);
+    for (size_t ind = 0; ind < hwStages.size(); ++ind) {
+        const auto& origStage = hwStages[ind];
+        const auto& tiling = tilings[ind];
+
+        const HWPoolStageOptions stageOptions(origStage);
+        const HWPoolStageIO stageIO(origStage, origStage->output(0));
 
-        if (!tiler.isTilingPossible()) {
+        if (!tiling.tilingPossible) {
             origStage->attrs().set<bool>("tryHW", false);
 
             auto swOutput = stageIO.origOutput;
@@ -100,8 +127,8 @@ void PassImpl::run(const Model& model) {
         model->disconnectStage(origStage);
 
 
-        for (const auto &tiling : tiler.getHwTilings()) {
-            HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, tiling);
+        for (const auto& hwTiling : tiling.hwTilings) {
+            HWPoolStageTiler hwStageTiler(stageOptions, stageIO, model, origStage, _stageBuilder, hwTiling);
             //
             // Split/concat input/output tiles
             //
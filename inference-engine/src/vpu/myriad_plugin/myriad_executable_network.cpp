@@ -14,6 +14,7 @@
 #include <vpu/utils/runtime_graph.hpp>
 #include <legacy/net_pass.h>
 #include <vpu/compile_env.hpp>
+#include <vpu/private_plugin_config.hpp>
 
 using namespace InferenceEngine;
 
@@ -80,6 +81,8 @@ ExecutableNetwork::ExecutableNetwork(
     _inputInfo  = std::move(compiledGraph->inputInfo);
     _outputInfo = std::move(compiledGraph->outputInfo);
 
+    _passesTime = std::move(compiledGraph->passesTime);
+
     if (!_device->isBooted()) {
         return;
     }
@@ -179,6 +182,8 @@ void ExecutableNetwork::GetMetric(const std::string &name, Parameter &result, Re
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(2u * _actualNumExecutors));
     } else if (name == METRIC_KEY(DEVICE_THERMAL)) {
         result = IE_SET_METRIC(DEVICE_THERMAL, _executor->GetThermal(_device));
+    } else if (name == MYRIAD_PASSES_TIME) {
+        result = _passesTime;
     } else {
         THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
     }
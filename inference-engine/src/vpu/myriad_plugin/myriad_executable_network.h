@@ -12,6 +12,7 @@
 #include <queue>
 #include <sstream>
 #include <fstream>
+#include <utility>
 
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
@@ -126,6 +127,7 @@ private:
     const ie::ICore* _core = nullptr;
     int _actualNumExecutors = 0;
     std::vector<std::string> _supportedMetrics;
+    std::vector<std::pair<std::string, double>> _passesTime;
 
     DataInfo _inputInfo;
     DataInfo _outputInfo;
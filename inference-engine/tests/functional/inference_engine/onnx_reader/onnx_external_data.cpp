@@ -0,0 +1,209 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ngraph/op/constant.hpp>
+
+#include "common_test_utils/perf_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+// Add of the input and the initializer "W", the data of the initializer are described by the tensor fields
+std::string makeModel(size_t elements, const std::string& tensorData) {
+    const auto dim = std::to_string(elements);
+    return R"V0G0N(
+ir_version: 6
+producer_name: "nGraph ONNX Importer"
+graph {
+  node {
+    input: "A"
+    input: "W"
+    output: "Y"
+    name: "add_node"
+    op_type: "Add"
+  }
+  name: "test_graph"
+  initializer {
+    dims: )V0G0N" + dim + R"V0G0N(
+    data_type: 1
+    name: "W"
+)V0G0N" + tensorData + R"V0G0N(
+  }
+  input {
+    name: "A"
+    type {
+      tensor_type {
+        elem_type: 1
+        shape {
+          dim {
+            dim_value: )V0G0N" + dim + R"V0G0N(
+          }
+        }
+      }
+    }
+  }
+  output {
+    name: "Y"
+    type {
+      tensor_type {
+        elem_type: 1
+        shape {
+          dim {
+            dim_value: )V0G0N" + dim + R"V0G0N(
+          }
+        }
+      }
+    }
+  }
+}
+opset_import {
+  version: 4
+}
+)V0G0N";
+}
+
+std::string externalData(const std::string& location, size_t offset, size_t length) {
+    return "    data_location: EXTERNAL\n"
+           "    external_data { key: \"location\" value: \"" + location + "\" }\n"
+           "    external_data { key: \"offset\" value: \"" + std::to_string(offset) + "\" }\n"
+           "    external_data { key: \"length\" value: \"" + std::to_string(length) + "\" }\n";
+}
+
+std::string rawData(const std::vector<float>& data) {
+    const auto bytes = reinterpret_cast<const unsigned char*>(data.data());
+    std::string escaped = "    raw_data: \"";
+    escaped.reserve(escaped.size() + 4 * data.size() * sizeof(float) + 2);
+    char octal[5];
+    for (size_t i = 0; i < data.size() * sizeof(float); ++i) {
+        std::snprintf(octal, sizeof(octal), "\\%03o", bytes[i]);
+        escaped += octal;
+    }
+    return escaped + "\"\n";
+}
+
+std::shared_ptr<ngraph::op::Constant> getWeights(const CNNNetwork& network) {
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+            return constant;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+class ONNXExternalDataTest : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        _weights.resize(_elements);
+        for (size_t i = 0; i < _elements; ++i) {
+            _weights[i] = static_cast<float>(i % 1024);
+        }
+        // the data do not start at the beginning of the file to check the offset
+        std::ofstream dataFile(_dataPath, std::ios::binary);
+        const std::vector<char> padding(_offset, 0);
+        dataFile.write(padding.data(), padding.size());
+        dataFile.write(reinterpret_cast<const char*>(_weights.data()), _weights.size() * sizeof(float));
+
+        std::ofstream modelFile(_modelPath);
+        modelFile << makeModel(_elements, externalData(_dataPath, _offset, _elements * sizeof(float)));
+        std::ofstream inlineModelFile(_inlineModelPath);
+        inlineModelFile << makeModel(_elements, rawData(_weights));
+    }
+
+    void TearDown() override {
+        std::remove(_modelPath.c_str());
+        std::remove(_inlineModelPath.c_str());
+        std::remove(_dataPath.c_str());
+    }
+
+    void checkWeights(const CNNNetwork& network) {
+        auto weights = getWeights(network);
+        ASSERT_NE(nullptr, weights);
+        ASSERT_EQ(ngraph::Shape{_elements}, weights->get_shape());
+        auto data = weights->get_data_ptr<float>();
+        for (size_t i = 0; i < _elements; i += 99) {
+            ASSERT_EQ(_weights[i], data[i]);
+        }
+    }
+
+    size_t _elements = 64 * 1024;
+    const size_t _offset = 100;
+    std::vector<float> _weights;
+    const std::string _modelPath = "ONNXExternalData_test.prototxt";
+    const std::string _inlineModelPath = "ONNXExternalData_inline_test.prototxt";
+    // the location in the model is relative to the directory of the model
+    const std::string _dataPath = "ONNXExternalData_test.data";
+};
+
+TEST_F(ONNXExternalDataTest, canReadExternalData) {
+    Core ie;
+    checkWeights(ie.ReadNetwork(_modelPath));
+}
+
+TEST_F(ONNXExternalDataTest, canReadInlineRawData) {
+    Core ie;
+    checkWeights(ie.ReadNetwork(_inlineModelPath));
+}
+
+TEST_F(ONNXExternalDataTest, throwsOnTooShortExternalData) {
+    std::ofstream modelFile(_modelPath);
+    modelFile << makeModel(_elements, externalData(_dataPath, _offset + 4, _elements * sizeof(float)));
+    modelFile.close();
+    Core ie;
+    ASSERT_ANY_THROW(ie.ReadNetwork(_modelPath));
+}
+
+TEST_F(ONNXExternalDataTest, throwsOnAbsoluteLocation) {
+    std::ofstream modelFile(_modelPath);
+    modelFile << makeModel(_elements, externalData("/" + _dataPath, _offset, _elements * sizeof(float)));
+    modelFile.close();
+    Core ie;
+    ASSERT_ANY_THROW(ie.ReadNetwork(_modelPath));
+}
+
+TEST_F(ONNXExternalDataTest, throwsOnLocationOutsideOfModelDirectory) {
+    std::ofstream modelFile(_modelPath);
+    modelFile << makeModel(_elements, externalData("data/../../" + _dataPath, _offset, _elements * sizeof(float)));
+    modelFile.close();
+    Core ie;
+    ASSERT_ANY_THROW(ie.ReadNetwork(_modelPath));
+}
+
+class ONNXExternalDataBenchmark : public ONNXExternalDataTest {
+protected:
+    ONNXExternalDataBenchmark() {
+        _elements = 4 * 1024 * 1024;
+    }
+};
+
+// Benchmark: import time and resident memory of the mapped external data compared to the inline raw data
+TEST_F(ONNXExternalDataBenchmark, DISABLED_importTimeAndMemory) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto measure = [&] (const std::string& name, std::function<CNNNetwork()> read) {
+        const auto rssBefore = CommonTestUtils::getResidentSetSizeInKB();
+        const auto start = Clock::now();
+        auto network = read();
+        const auto elapsed = Clock::now() - start;
+        const auto rssAfter = CommonTestUtils::getResidentSetSizeInKB();
+        checkWeights(network);
+        CommonTestUtils::reportPerf(name + " import time", CommonTestUtils::toMicroseconds(elapsed) / 1000, "ms");
+        CommonTestUtils::reportPerf(name + " RSS delta", rssAfter > rssBefore ? (rssAfter - rssBefore) / 1024. : 0., "MB");
+    };
+    Core ie;
+    measure("inline raw_data", [&] { return ie.ReadNetwork(_inlineModelPath); });
+    measure("external data", [&] { return ie.ReadNetwork(_modelPath); });
+}
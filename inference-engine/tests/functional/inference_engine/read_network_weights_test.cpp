@@ -0,0 +1,167 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ngraph/op/constant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/perf_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::string makeModel(size_t elements) {
+    const auto dim = std::to_string(elements);
+    return R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="data" type="Parameter" version="opset1">
+            <data element_type="f32" shape=")V0G0N" + dim + R"V0G0N("/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="weights" type="Const" version="opset1">
+            <data offset="0" size=")V0G0N" + std::to_string(elements * sizeof(float)) + R"V0G0N("/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>)V0G0N" + dim + R"V0G0N(</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+}
+
+std::shared_ptr<ngraph::op::Constant> getWeights(const CNNNetwork& network) {
+    for (const auto& op : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+            return constant;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+class ReadNetworkWeightsTest : public CommonTestUtils::TestsCommon {
+protected:
+    void SetUp() override {
+        std::ofstream modelFile(_modelPath);
+        modelFile << makeModel(_elements);
+        std::ofstream weightsFile(_weightsPath, std::ios::binary);
+        std::vector<float> weights(_elements);
+        for (size_t i = 0; i < _elements; ++i) {
+            weights[i] = static_cast<float>(i % 1024);
+        }
+        weightsFile.write(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeIRFiles(_modelPath, _weightsPath);
+    }
+
+    size_t _elements = 1024 * 1024;
+    const std::string _modelPath = "ReadNetworkWeights_test.xml";
+    const std::string _weightsPath = "ReadNetworkWeights_test.bin";
+};
+
+TEST_F(ReadNetworkWeightsTest, canReadMappedWeights) {
+    Core ie;
+    auto network = ie.ReadNetwork(_modelPath, _weightsPath);
+    auto weights = getWeights(network);
+    ASSERT_NE(nullptr, weights);
+    auto data = weights->get_data_ptr<float>();
+    for (size_t i = 0; i < _elements; i += 4099) {
+        ASSERT_EQ(static_cast<float>(i % 1024), data[i]);
+    }
+}
+
+TEST_F(ReadNetworkWeightsTest, canUseMappedWeightsAfterFilesAreRemoved) {
+    Core ie;
+    auto network = ie.ReadNetwork(_modelPath, _weightsPath);
+    CommonTestUtils::removeIRFiles(_modelPath, _weightsPath);
+    auto weights = getWeights(network);
+    ASSERT_NE(nullptr, weights);
+    auto data = weights->get_data_ptr<float>();
+    for (size_t i = 0; i < _elements; i += 4099) {
+        ASSERT_EQ(static_cast<float>(i % 1024), data[i]);
+    }
+}
+
+class ReadNetworkWeightsBenchmark : public ReadNetworkWeightsTest {
+protected:
+    ReadNetworkWeightsBenchmark() {
+        _elements = 16 * 1024 * 1024;
+    }
+
+    // Reads the weights through the stream into the user blob
+    CNNNetwork readFromStream(Core& ie) {
+        std::ifstream modelFile(_modelPath);
+        std::string model((std::istreambuf_iterator<char>(modelFile)), std::istreambuf_iterator<char>());
+        std::ifstream weightsFile(_weightsPath, std::ios::binary);
+        auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {_elements * sizeof(float)}, Layout::C));
+        weights->allocate();
+        weightsFile.read(weights->buffer().as<char*>(), weights->byteSize());
+        return ie.ReadNetwork(model, weights);
+    }
+};
+
+// Benchmark: load time and resident memory of memory mapped weights compared to stream reading
+TEST_F(ReadNetworkWeightsBenchmark, DISABLED_mappedWeightsLoadTimeAndMemory) {
+    using Clock = std::chrono::high_resolution_clock;
+    auto measure = [&] (const std::string& name, std::function<CNNNetwork()> read) {
+        const auto rssBefore = CommonTestUtils::getResidentSetSizeInKB();
+        const auto start = Clock::now();
+        auto network = read();
+        const auto elapsed = Clock::now() - start;
+        const auto rssAfter = CommonTestUtils::getResidentSetSizeInKB();
+        ASSERT_NE(nullptr, getWeights(network));
+        CommonTestUtils::reportPerf(name + " read time", CommonTestUtils::toMicroseconds(elapsed) / 1000, "ms");
+        CommonTestUtils::reportPerf(name + " RSS delta", rssAfter > rssBefore ? (rssAfter - rssBefore) / 1024. : 0., "MB");
+    };
+    Core ie;
+    measure("stream", [&] { return readFromStream(ie); });
+    measure("mmap", [&] { return ie.ReadNetwork(_modelPath, _weightsPath); });
+}
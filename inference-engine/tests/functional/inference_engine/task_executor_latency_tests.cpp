@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <ie_system_conf.h>
+
+#include "common_test_utils/perf_utils.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+using Clock = std::chrono::high_resolution_clock;
+
+static constexpr const auto NUMBER_OF_PRODUCERS = 4;
+static constexpr const auto NUMBER_OF_TASKS_PER_PRODUCER = 2000;
+
+class CPUStreamsExecutorLatencyTests : public ::testing::TestWithParam<int> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+};
+
+// Micro-benchmark: measures the time between `run()` call and the start of the task execution.
+// Only the execution of every task is checked, the latencies are reported.
+TEST_P(CPUStreamsExecutorLatencyTests, enqueueToStartLatency) {
+    const auto streams = GetParam();
+    const auto numberOfTasks = NUMBER_OF_PRODUCERS * NUMBER_OF_TASKS_PER_PRODUCER;
+    std::vector<Clock::duration> latencies(numberOfTasks, Clock::duration::min());
+    std::vector<std::future<void>> futures;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutorLatency",
+                                    streams, 1, IStreamsExecutor::ThreadBindingType::NONE}};
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < NUMBER_OF_PRODUCERS; ++producer) {
+            auto p = std::make_shared<std::packaged_task<void()>>([&, producer] {
+                for (int i = 0; i < NUMBER_OF_TASKS_PER_PRODUCER; ++i) {
+                    auto& latency = latencies[producer * NUMBER_OF_TASKS_PER_PRODUCER + i];
+                    auto enqueued = Clock::now();
+                    executor.run([&latency, enqueued] {
+                        latency = Clock::now() - enqueued;
+                    });
+                }
+            });
+            futures.emplace_back(p->get_future());
+            producers.emplace_back([p] {(*p)();});
+        }
+        for (auto&& producer : producers) producer.join();
+    }
+    for (auto&& f : futures) ASSERT_NO_THROW(f.get());
+    // the executor waits for its tasks on destruction
+    ASSERT_EQ(0, std::count(latencies.begin(), latencies.end(), Clock::duration::min()));
+
+    std::sort(latencies.begin(), latencies.end());
+    auto average = std::accumulate(latencies.begin(), latencies.end(), Clock::duration::zero()) / numberOfTasks;
+    CommonTestUtils::reportPerf("average latency", CommonTestUtils::toMicroseconds(average), "us");
+    CommonTestUtils::reportPerf("p50 latency", CommonTestUtils::toMicroseconds(latencies[numberOfTasks / 2]), "us");
+    CommonTestUtils::reportPerf("p99 latency", CommonTestUtils::toMicroseconds(latencies[numberOfTasks * 99 / 100]), "us");
+    CommonTestUtils::reportPerf("max latency", CommonTestUtils::toMicroseconds(latencies.back()), "us");
+}
+
+static std::vector<int> streamsNumbers() {
+    std::vector<int> result;
+    for (int streams = 1; streams < getNumberOfCPUCores(); streams *= 2) {
+        result.push_back(streams);
+    }
+    result.push_back(getNumberOfCPUCores());
+    return result;
+}
+
+INSTANTIATE_TEST_CASE_P(DISABLED_CPUStreamsExecutorLatencyTests, CPUStreamsExecutorLatencyTests,
+                        ::testing::ValuesIn(streamsNumbers()),
+                        CPUStreamsExecutorLatencyTests::getTestCaseName);
@@ -2,7 +2,12 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
 #include <future>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -212,3 +217,61 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_CASE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+
+class CPUStreamsExecutorTests : public ::testing::TestWithParam<int> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int>& obj) {
+        return "streams=" + std::to_string(obj.param);
+    }
+};
+
+TEST_P(CPUStreamsExecutorTests, runsEveryTaskOfMultipleProducersOnce) {
+    static constexpr const auto NUMBER_OF_PRODUCERS = 4;
+    static constexpr const auto NUMBER_OF_TASKS_PER_PRODUCER = 1000;
+    std::vector<std::atomic_int> executions(NUMBER_OF_PRODUCERS * NUMBER_OF_TASKS_PER_PRODUCER);
+    for (auto&& execution : executions) execution = 0;
+    std::vector<Future> futures;
+    {
+        CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                    GetParam(), 1, IStreamsExecutor::ThreadBindingType::NONE}};
+        std::vector<std::thread> producers;
+        for (int producer = 0; producer < NUMBER_OF_PRODUCERS; ++producer) {
+            auto p = std::make_shared<std::packaged_task<void()>>([&, producer] {
+                for (int i = 0; i < NUMBER_OF_TASKS_PER_PRODUCER; ++i) {
+                    auto& execution = executions[producer * NUMBER_OF_TASKS_PER_PRODUCER + i];
+                    executor.run([&execution] { ++execution; });
+                }
+            });
+            futures.emplace_back(p->get_future());
+            producers.emplace_back([p] {(*p)();});
+        }
+        for (auto&& producer : producers) producer.join();
+    }
+    for (auto&& f : futures) ASSERT_NO_THROW(f.get());
+    for (auto&& execution : executions) ASSERT_EQ(1, execution);
+}
+
+TEST_P(CPUStreamsExecutorTests, idleStreamStealsTaskOfBusyStream) {
+    auto taskExecutor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                             GetParam(), 1, IStreamsExecutor::ThreadBindingType::NONE});
+    // The nested task is pushed to the queue of the stream which waits for it, so only another stream can run it
+    auto f = async(taskExecutor, [&] {
+        auto nested = async(taskExecutor, [] {});
+        nested.wait();
+        nested.get();
+    });
+    ASSERT_EQ(std::future_status::ready, f.wait_for(std::chrono::seconds(10)));
+    ASSERT_NO_THROW(f.get());
+}
+
+static std::vector<int> streamsNumbers() {
+    std::vector<int> result = {2};
+    if (getNumberOfCPUCores() > 2) {
+        result.push_back(getNumberOfCPUCores());
+    }
+    return result;
+}
+
+INSTANTIATE_TEST_CASE_P(CPUStreamsExecutorTests, CPUStreamsExecutorTests,
+                        ::testing::ValuesIn(streamsNumbers()),
+                        CPUStreamsExecutorTests::getTestCaseName);
@@ -0,0 +1,50 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include "single_layer_tests/non_max_suppression.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+using namespace LayerTestsDefinitions;
+
+namespace {
+
+const std::vector<NmsInputShapeParams> inShapeParams = {
+    NmsInputShapeParams{1, 100, 5},
+    NmsInputShapeParams{2, 4000, 80},
+};
+
+// Many boxes filtered by the score threshold and few outputs per class
+const auto nmsParams = ::testing::Combine(
+    ::testing::ValuesIn(inShapeParams),
+    ::testing::Values(10, 4000),
+    ::testing::Values(0.5f),
+    ::testing::Values(0.f, 0.9f),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_CASE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// Score threshold regime: most of the boxes are filtered out before the suppression
+const auto nmsScoreThresholdBenchmarkParams = ::testing::Combine(
+    ::testing::Values(NmsInputShapeParams{2, 4000, 80}),
+    ::testing::Values(4000),
+    ::testing::Values(0.5f),
+    ::testing::Values(0.9f),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+// Max output regime: all boxes are candidates, few of them are selected per class
+const auto nmsMaxOutputBenchmarkParams = ::testing::Combine(
+    ::testing::Values(NmsInputShapeParams{2, 4000, 80}),
+    ::testing::Values(10),
+    ::testing::Values(0.5f),
+    ::testing::Values(0.f),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU));
+
+INSTANTIATE_TEST_CASE_P(DISABLED_NmsScoreThresholdBenchmark, NmsLayerBenchmark, nmsScoreThresholdBenchmarkParams,
+                        NmsLayerTest::getTestCaseName);
+INSTANTIATE_TEST_CASE_P(DISABLED_NmsMaxOutputBenchmark, NmsLayerBenchmark, nmsMaxOutputBenchmarkParams,
+                        NmsLayerTest::getTestCaseName);
+
+}  // namespace
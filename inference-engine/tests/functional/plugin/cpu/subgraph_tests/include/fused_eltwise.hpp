@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    bool,           // The chain has a per-channel operand
+    unsigned int,   // Minimal number of the collapsed layers
+    std::string     // Target Device
+> fusedEltwiseParams;
+
+class FusedEltwiseTest : public testing::WithParamInterface<fusedEltwiseParams>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<fusedEltwiseParams> obj);
+
+protected:
+    void SetUp() override;
+
+    bool perChannel = false;
+    unsigned int minCollapsed = 0;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,36 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // HETERO_MAX_SUBGRAPHS value
+    size_t,         // Expected number of subgraphs
+    std::string     // Device registered twice as the HETERO fallback devices
+> heteroPartitioningParams;
+
+// Chain of convolutions: the first half is cheap on <device>0 in the cost table, the second half on <device>1
+class HeteroPartitioningTest : public testing::WithParamInterface<heteroPartitioningParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<heteroPartitioningParams> obj);
+
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    const std::string costTable = "hetero_partitioning_costs.txt";
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // HETERO_PIPELINED_EXECUTION value
+    std::string     // Device registered twice as the HETERO fallback devices
+> heteroPipelinedExecutionParams;
+
+// Chain of convolutions split into three subgraphs: <device>0, <device>1, <device>0
+class HeteroPipelinedExecutionTest : public testing::WithParamInterface<heteroPipelinedExecutionParams>,
+                                     virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<heteroPipelinedExecutionParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,30 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // CPU_THROUGHPUT_STREAMS value
+    std::string     // Target Device
+> hwPerfCountersParams;
+
+class HwPerfCountersTest : public testing::WithParamInterface<hwPerfCountersParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<hwPerfCountersParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    InferenceEngine::Precision,         // Network Precision
+    std::string,                        // Target Device
+    std::map<std::string, std::string>  // Configuration
+> exportImportNetworkParams;
+
+class ImportNetworkTest : public testing::WithParamInterface<exportImportNetworkParams>,
+                          virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<exportImportNetworkParams> obj);
+
+    void Run() override;
+
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    std::vector<std::vector<std::uint8_t>> CalculateOutputs(InferenceEngine::ExecutableNetwork& network);
+
+    const std::string exportedModel = "exported_cpu_model.blob";
+};
+
+class CompiledNetworkCacheTest : public ImportNetworkTest {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    std::shared_ptr<ngraph::Function> makeFunctionWithClamp(double max) const;
+    std::shared_ptr<ngraph::Function> makeFunctionWithTensorIterator() const;
+
+    const std::string cacheDir = "cpu_compiled_network_cache";
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,32 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // CPU_LAYOUT_ASSIGNMENT value
+    std::string     // Target Device
+> layoutAssignmentParams;
+
+class LayoutAssignmentTest : public testing::WithParamInterface<layoutAssignmentParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<layoutAssignmentParams> obj);
+
+protected:
+    void SetUp() override;
+
+    size_t CountReorders(InferenceEngine::ExecutableNetwork& network) const;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // Model name, see ngraph::builder::subgraph
+    std::string,    // CPU_MEMORY_PLANNER value
+    std::string     // Target Device
+> memoryPlannersParams;
+
+class MemoryPlannersTest : public testing::WithParamInterface<memoryPlannersParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<memoryPlannersParams> obj);
+
+protected:
+    void SetUp() override;
+
+    uint64_t GetActivationsMemorySize(InferenceEngine::ExecutableNetwork& network) const;
+};
+
+}  // namespace LayerTestsDefinitions
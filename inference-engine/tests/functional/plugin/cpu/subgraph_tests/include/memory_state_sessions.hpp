@@ -0,0 +1,43 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    size_t,         // Number of infer requests
+    size_t,         // Number of sessions
+    std::string     // Target Device
+> memoryStateSessionsParams;
+
+class MemoryStateSessionsTest : public testing::WithParamInterface<memoryStateSessionsParams>,
+                                virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<memoryStateSessionsParams> obj);
+
+protected:
+    void SetUp() override;
+
+    // Loads the network, creates the requests and the inputs of the sessions
+    void Prepare(std::vector<InferenceEngine::InferRequest>& requests);
+    // Runs every session the given number of steps, the sessions are swapped in and out of the requests
+    void RunSessions(std::vector<InferenceEngine::InferRequest>& requests,
+                     std::vector<InferenceEngine::Blob::CPtr>& sessionStates, size_t steps);
+
+    size_t numRequests = 0;
+    size_t numSessions = 0;
+};
+
+class MemoryStateSessionsBenchmark : public MemoryStateSessionsTest {};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // MULTI scheduling policy
+    std::string,    // Device of the MULTI priorities
+    size_t          // Number of the device instances
+> multiSchedulingParams;
+
+class MultiSchedulingTest : public testing::WithParamInterface<multiSchedulingParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<multiSchedulingParams> obj);
+
+protected:
+    void SetUp() override;
+
+    std::vector<std::string> devices;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,34 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // NETWORK_CACHE_SIZE value
+    std::string     // Target Device
+> networkCacheParams;
+
+class NetworkCacheTest : public testing::WithParamInterface<networkCacheParams>,
+                         virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<networkCacheParams> obj);
+
+protected:
+    void SetUp() override;
+
+    // Reshapes the network to the width, loads and infers it, returns the dimensions of the loaded network input
+    InferenceEngine::SizeVector LoadWithWidth(size_t width);
+    unsigned int GetCacheMetric(const std::string& name) const;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,35 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    InferenceEngine::Layout,    // Layout of the output blob set by the user
+    std::string                 // Target Device
+> outputZeroCopyParams;
+
+// Segmentation-like network with a large output
+class OutputZeroCopyTest : public testing::WithParamInterface<outputZeroCopyParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<outputZeroCopyParams> obj);
+
+protected:
+    void SetUp() override;
+
+    InferenceEngine::Blob::Ptr MakeUserOutput() const;
+
+    InferenceEngine::Layout userLayout;
+};
+
+}  // namespace LayerTestsDefinitions
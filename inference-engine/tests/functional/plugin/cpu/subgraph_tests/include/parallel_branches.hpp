@@ -0,0 +1,32 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    size_t,         // Number of independent branches
+    std::string,    // CPU_PARALLEL_BRANCHES value
+    std::string     // Target Device
+> parallelBranchesParams;
+
+// Inception-like block: several independent branches of small convolutions joined by concat
+class ParallelBranchesTest : public testing::WithParamInterface<parallelBranchesParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<parallelBranchesParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+}  // namespace LayerTestsDefinitions
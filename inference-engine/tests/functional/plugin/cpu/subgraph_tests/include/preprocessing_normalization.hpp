@@ -0,0 +1,35 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    InferenceEngine::Layout,            // Input layout
+    std::map<std::string, std::string>, // Configuration
+    std::string                         // Target Device
+> preprocessingNormalizationParams;
+
+// U8 input with mean values and scales: the normalization is fused into the G-API resize when it is requested
+class PreprocessingNormalizationTest : public testing::WithParamInterface<preprocessingNormalizationParams>,
+                                       virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<preprocessingNormalizationParams> obj);
+
+protected:
+    void SetUp() override;
+
+    InferenceEngine::Blob::Ptr InferWithResize(InferenceEngine::ResizeAlgorithm algorithm);
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,39 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    size_t,         // Number of infer requests
+    std::string     // Target Device
+> requestTracingParams;
+
+class RequestTracingTest : public testing::WithParamInterface<requestTracingParams>,
+                           virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<requestTracingParams> obj);
+
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    // Runs all the requests asynchronously the given number of rounds
+    void RunRequests(std::vector<InferenceEngine::InferRequest>& requests, size_t rounds);
+
+    size_t numRequests = 0;
+    const std::string traceFile = "request_tracing_test.json";
+    const std::string restartedTraceFile = "request_tracing_restarted_test.json";
+};
+
+}  // namespace LayerTestsDefinitions
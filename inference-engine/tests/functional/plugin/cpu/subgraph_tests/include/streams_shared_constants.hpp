@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    size_t,     // Number of streams
+    std::string // Target Device
+> streamsSharedConstantsParams;
+
+class StreamsSharedConstantsTest : public testing::WithParamInterface<streamsSharedConstantsParams>,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<streamsSharedConstantsParams> obj);
+
+protected:
+    void SetUp() override;
+    void InferConcurrently();
+
+    size_t streams = 1;
+};
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,36 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <tuple>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+typedef std::tuple<
+    std::string,    // Body type: "Map" without back edges or "Scan" with a back edge
+    std::string     // Target Device
+> tensorIteratorPortMappingParams;
+
+class TensorIteratorPortMappingTest : public testing::WithParamInterface<tensorIteratorPortMappingParams>,
+                                      virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<tensorIteratorPortMappingParams> obj);
+
+protected:
+    void SetUp() override;
+
+    // Returns the execution details of the TensorIterator node from the execution graph
+    std::map<std::string, std::string> GetTensorIteratorInfo();
+
+    std::string bodyType;
+};
+
+}  // namespace LayerTestsDefinitions
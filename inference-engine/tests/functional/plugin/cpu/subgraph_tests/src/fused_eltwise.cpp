@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <ngraph/variant.hpp>
+
+#include "exec_graph_info.hpp"
+#include "subgraph_tests/include/fused_eltwise.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string FusedEltwiseTest::getTestCaseName(testing::TestParamInfo<fusedEltwiseParams> obj) {
+    bool perChannel;
+    unsigned int minCollapsed;
+    std::string targetDevice;
+    std::tie(perChannel, minCollapsed, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "perChannel=" << perChannel << "_";
+    result << "minCollapsed=" << minCollapsed << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+// out = relu(tanh((x + y) * scale) * x), the scale is either per-channel or a full tensor
+void FusedEltwiseTest::SetUp() {
+    std::tie(perChannel, minCollapsed, targetDevice) = this->GetParam();
+    const size_t C = 16, H = 16, W = 16;
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, C, H, W}, {1, C, H, W} });
+    auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+    const std::vector<size_t> scaleShape = perChannel ? std::vector<size_t>{1, C, 1, 1} : std::vector<size_t>{1, C, H, W};
+    auto scale = ngraph::builder::makeConstant(ngraph::element::f32, scaleShape, {}, true);
+    auto mul = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+    mul->set_friendly_name("scale");
+    auto tanh = std::make_shared<ngraph::opset1::Tanh>(mul);
+    auto gate = std::make_shared<ngraph::opset1::Multiply>(tanh, params[0]);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(gate);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(relu) };
+    function = std::make_shared<ngraph::Function>(results, params, "FusedEltwise");
+}
+
+TEST_P(FusedEltwiseTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto collapsed = executableNetwork.GetMetric(METRIC_KEY(COLLAPSED_ELTWISE_LAYERS)).as<unsigned int>();
+    ASSERT_GE(collapsed, minCollapsed);
+
+    // The per-channel operand is left to the nodes which keep the blocked layouts
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    bool scaleIsFused = false;
+    for (const auto& op : execGraph->get_ops()) {
+        auto& rtInfo = op->get_rt_info();
+        auto layerType = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        auto originalNames = rtInfo.find(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+        if (layerType == rtInfo.end() || originalNames == rtInfo.end())
+            continue;
+        auto type = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(layerType->second);
+        auto names = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(originalNames->second);
+        ASSERT_NE(nullptr, type);
+        ASSERT_NE(nullptr, names);
+        if (type->get() == "FusedEltwise" && ("," + names->get() + ",").find(",scale,") != std::string::npos)
+            scaleIsFused = true;
+    }
+    ASSERT_EQ(!perChannel, scaleIsFused);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(FusedEltwise, FusedEltwiseTest,
+    ::testing::Values(
+        std::make_tuple(false, 5u, CommonTestUtils::DEVICE_CPU),
+        std::make_tuple(true, 3u, CommonTestUtils::DEVICE_CPU)),
+    FusedEltwiseTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
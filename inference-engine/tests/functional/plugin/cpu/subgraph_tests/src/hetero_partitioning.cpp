@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <hetero/hetero_plugin_config.hpp>
+
+#include "subgraph_tests/include/hetero_partitioning.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string HeteroPartitioningTest::getTestCaseName(testing::TestParamInfo<heteroPartitioningParams> obj) {
+    std::string maxSubgraphs;
+    size_t subgraphs;
+    std::string device;
+    std::tie(maxSubgraphs, subgraphs, device) = obj.param;
+
+    std::ostringstream result;
+    result << "maxSubgraphs=" << maxSubgraphs << "_";
+    result << "device=" << device;
+    return result.str();
+}
+
+void HeteroPartitioningTest::SetUp() {
+    std::string maxSubgraphs;
+    size_t subgraphs;
+    std::string device;
+    std::tie(maxSubgraphs, subgraphs, device) = this->GetParam();
+    const auto devices = CPUTestUtils::registerCPUDevices(core, device, 2);
+    targetDevice = CommonTestUtils::DEVICE_HETERO;
+    configuration["TARGET_FALLBACK"] = devices[0] + "," + devices[1];
+    configuration[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = InferenceEngine::HeteroConfigParams::HETERO_MIN_LATENCY;
+    configuration[HETERO_CONFIG_KEY(COST_TABLE)] = costTable;
+    configuration[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = maxSubgraphs;
+    configuration[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = CONFIG_VALUE(YES);
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+
+    const size_t convolutions = 6;
+    function = ngraph::builder::subgraph::makeConvReluChain({1, 16, 28, 28}, convolutions);
+    function->set_friendly_name("HeteroPartitioning");
+
+    // the first half of the convolutions is fast on the first device, the second half on the second one
+    std::ofstream table(costTable);
+    table << "# device layer microseconds" << std::endl;
+    for (size_t i = 0; i < convolutions; i++) {
+        const auto conv = "Conv_" + std::to_string(i);
+        table << devices[0] << " " << conv << " " << (i < convolutions / 2 ? 10 : 1000) << std::endl;
+        table << devices[1] << " " << conv << " " << (i < convolutions / 2 ? 1000 : 10) << std::endl;
+    }
+}
+
+void HeteroPartitioningTest::TearDown() {
+    std::remove(costTable.c_str());
+    // the files dumped by the hetero plugin with the DUMP_GRAPH_DOT config
+    const auto& name = function->get_friendly_name();
+    for (auto&& dump : {"hetero_partition_" + name + ".txt", "hetero_affinity_" + name + ".dot",
+                        "hetero_subgraphs_" + name + ".dot"}) {
+        std::remove(dump.c_str());
+    }
+}
+
+TEST_P(HeteroPartitioningTest, minLatencyPolicyFollowsCostTable) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::ifstream dump("hetero_partition_" + cnnNetwork.getName() + ".txt");
+    EXPECT_TRUE(dump.is_open());
+
+    std::set<std::string> subgraphs;
+    for (auto&& perfCount : inferRequest.GetPerformanceCounts()) {
+        subgraphs.insert(perfCount.first.substr(0, perfCount.first.find(':')));
+    }
+    EXPECT_EQ(std::get<1>(GetParam()), subgraphs.size());
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(HeteroPartitioning, HeteroPartitioningTest,
+    ::testing::Values(
+        std::make_tuple("0", 2, CommonTestUtils::DEVICE_CPU),
+        std::make_tuple("1", 1, CommonTestUtils::DEVICE_CPU)),
+    HeteroPartitioningTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
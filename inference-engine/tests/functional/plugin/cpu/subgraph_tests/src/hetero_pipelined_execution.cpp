@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <hetero/hetero_plugin_config.hpp>
+#include <ngraph/variant.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "subgraph_tests/include/hetero_pipelined_execution.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string HeteroPipelinedExecutionTest::getTestCaseName(
+        testing::TestParamInfo<heteroPipelinedExecutionParams> obj) {
+    std::string pipelined;
+    std::string device;
+    std::tie(pipelined, device) = obj.param;
+
+    std::ostringstream result;
+    result << "pipelined=" << pipelined << "_";
+    result << "device=" << device;
+    return result.str();
+}
+
+void HeteroPipelinedExecutionTest::SetUp() {
+    std::string pipelined;
+    std::string device;
+    std::tie(pipelined, device) = this->GetParam();
+    const auto devices = CPUTestUtils::registerCPUDevices(core, device, 2);
+    targetDevice = CommonTestUtils::DEVICE_HETERO;
+    configuration["TARGET_FALLBACK"] = devices[0] + "," + devices[1];
+    configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] = pipelined;
+
+    // the convolutions and their ReLUs are split into three subgraphs
+    const std::vector<std::string> affinities{devices[0], devices[0], devices[1], devices[1], devices[0], devices[0]};
+    function = ngraph::builder::subgraph::makeConvReluChain({1, 16, 56, 56}, affinities.size());
+    function->set_friendly_name("HeteroPipelinedExecution");
+    size_t convolutions = 0;
+    for (auto&& node : function->get_ordered_ops()) {
+        convolutions += ngraph::is_type<ngraph::opset1::Convolution>(node) ? 1 : 0;
+        if (ngraph::is_type<ngraph::opset1::Convolution>(node) || ngraph::is_type<ngraph::opset1::Relu>(node)) {
+            node->get_rt_info()["affinity"] =
+                std::make_shared<ngraph::VariantWrapper<std::string>>(affinities[convolutions - 1]);
+        }
+    }
+}
+
+// Several requests with different inputs are in flight at once, so the stages of the pipeline overlap
+TEST_P(HeteroPipelinedExecutionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto inputInfo = cnnNetwork.getInputsInfo().begin()->second;
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<InferenceEngine::Blob::Ptr> requestInputs;
+    for (int i = 0; i < 6; i++) {
+        requestInputs.push_back(FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc(), 10, -5 + i));
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(inputInfo->name(), requestInputs.back());
+        requests.back().StartAsync();
+    }
+    for (size_t i = 0; i < requests.size(); i++) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK,
+                  requests[i].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        inputs = {requestInputs[i]};
+        Compare(CalculateRefs().front(), requests[i].GetBlob(outputName));
+    }
+
+    // every subgraph is a stage of the pipeline
+    auto perfCounts = requests.front().GetPerformanceCounts();
+    EXPECT_EQ(configuration[HETERO_CONFIG_KEY(PIPELINED_EXECUTION)] == CONFIG_VALUE(YES) ? 3 : 0,
+        std::count_if(perfCounts.begin(), perfCounts.end(),
+            [] (const std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>::value_type& perfCount) {
+                return perfCount.first.find("pipeline_stage_occupancy") != std::string::npos;
+            }));
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(HeteroPipelinedExecution, HeteroPipelinedExecutionTest,
+    ::testing::Combine(
+        ::testing::Values(CONFIG_VALUE(NO), CONFIG_VALUE(YES)),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    HeteroPipelinedExecutionTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,67 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+
+#include <ie_plugin_config.hpp>
+
+#include "subgraph_tests/include/hw_perf_counters.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string HwPerfCountersTest::getTestCaseName(testing::TestParamInfo<hwPerfCountersParams> obj) {
+    std::string streams;
+    std::string targetDevice;
+    std::tie(streams, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "streams=" << streams << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void HwPerfCountersTest::SetUp() {
+    std::string streams;
+    std::tie(streams, targetDevice) = this->GetParam();
+    configuration[CONFIG_KEY(CPU_HW_PERF_COUNTERS)] = CONFIG_VALUE(YES);
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = streams;
+    function = ngraph::builder::subgraph::makeConvReluChain({1, 32, 56, 56});
+    function->set_friendly_name("HwPerfCounters");
+}
+
+TEST_P(HwPerfCountersTest, reportsEventsOfExecutedLayers) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    const size_t inferences = 4;
+    for (size_t i = 1; i < inferences; i++)
+        inferRequest.Infer();
+
+    using Counters = std::map<std::string, std::map<std::string, uint64_t>>;
+    const auto counters = executableNetwork.GetMetric(METRIC_KEY(HW_PERF_COUNTERS)).as<Counters>();
+    if (counters.empty()) {
+        GTEST_SKIP() << "Perf events are not permitted on this system";
+    }
+
+    // the events of every stream are summed up
+    uint64_t instructions = 0;
+    for (const auto& layer : counters) {
+        ASSERT_EQ(inferences, layer.second.at(METRIC_VALUE(EXECUTIONS))) << layer.first;
+        instructions += layer.second.at(METRIC_VALUE(INSTRUCTIONS));
+    }
+    ASSERT_GT(instructions, 0u);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(HwPerfCounters, HwPerfCountersTest,
+    ::testing::Combine(
+        ::testing::Values("1", "2"),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    HwPerfCountersTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
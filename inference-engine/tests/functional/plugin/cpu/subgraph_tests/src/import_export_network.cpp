@@ -0,0 +1,211 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "subgraph_tests/include/import_export_network.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string ImportNetworkTest::getTestCaseName(testing::TestParamInfo<exportImportNetworkParams> obj) {
+    InferenceEngine::Precision netPrecision;
+    std::string targetDevice;
+    std::map<std::string, std::string> configuration;
+    std::tie(netPrecision, targetDevice, configuration) = obj.param;
+
+    std::ostringstream result;
+    result << "netPRC=" << netPrecision.name() << "_";
+    result << "targetDevice=" << targetDevice;
+    for (auto const& configItem : configuration) {
+        result << "_configItem=" << configItem.first << "_" << configItem.second;
+    }
+    return result.str();
+}
+
+void ImportNetworkTest::Run() {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ConfigurePlugin();
+    LoadNetwork();
+    Infer();
+    executableNetwork.Export(exportedModel);
+
+    const auto& actualOutputs = GetOutputs();
+    auto referenceOutputs = CalculateRefs();
+    Compare(referenceOutputs, actualOutputs);
+
+    std::fstream inputStream(exportedModel, std::ios_base::in | std::ios_base::binary);
+    if (inputStream.fail()) {
+        FAIL() << "Cannot open file to import model: " << exportedModel;
+    }
+    auto importedNetwork = core->ImportNetwork(inputStream, targetDevice, configuration);
+    Compare(CalculateOutputs(importedNetwork), actualOutputs);
+}
+
+void ImportNetworkTest::SetUp() {
+    InferenceEngine::Precision netPrecision;
+    std::tie(netPrecision, targetDevice, configuration) = this->GetParam();
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+
+    auto params = ngraph::builder::makeParams(ngPrc, { {1, 3, 16, 16} });
+    auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, { 3, 3 }, { 1, 1 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+        ngraph::op::PadType::EXPLICIT, 8);
+    auto relu1 = std::make_shared<ngraph::opset1::Relu>(conv1);
+    auto conv2 = ngraph::builder::makeConvolution(relu1, ngPrc, { 1, 1 }, { 1, 1 }, { 0, 0 }, { 0, 0 }, { 1, 1 },
+        ngraph::op::PadType::EXPLICIT, 4);
+
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(conv2) };
+    function = std::make_shared<ngraph::Function>(results, params, "ExportImportNetwork");
+}
+
+void ImportNetworkTest::TearDown() {
+    std::remove(exportedModel.c_str());
+}
+
+std::vector<std::vector<std::uint8_t>> ImportNetworkTest::CalculateOutputs(InferenceEngine::ExecutableNetwork& network) {
+    auto inferRequest = network.CreateInferRequest();
+    std::vector<InferenceEngine::InputInfo::CPtr> infos;
+    for (const auto& input : network.GetInputsInfo()) {
+        infos.push_back(input.second);
+    }
+
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        inferRequest.SetBlob(infos[i]->name(), inputs[i]);
+    }
+
+    inferRequest.Infer();
+
+    auto outputs = std::vector<std::vector<std::uint8_t>>{};
+    for (const auto& output : network.GetOutputsInfo()) {
+        auto memory = InferenceEngine::as<InferenceEngine::MemoryBlob>(inferRequest.GetBlob(output.first));
+        IE_ASSERT(memory);
+        const auto lockedMemory = memory->rmap();
+        const auto buffer = lockedMemory.as<const std::uint8_t*>();
+        outputs.emplace_back(buffer, buffer + memory->byteSize());
+    }
+    return outputs;
+}
+
+void CompiledNetworkCacheTest::SetUp() {
+    ImportNetworkTest::SetUp();
+    CommonTestUtils::createDirectory(cacheDir);
+}
+
+void CompiledNetworkCacheTest::TearDown() {
+    CommonTestUtils::removeFilesWithExt(cacheDir, "blob");
+    CommonTestUtils::removeDir(cacheDir);
+}
+
+std::shared_ptr<ngraph::Function> CompiledNetworkCacheTest::makeFunctionWithClamp(double max) const {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 3, 16, 16} });
+    auto clamp = std::make_shared<ngraph::opset1::Clamp>(params[0], 0., max);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(clamp) };
+    return std::make_shared<ngraph::Function>(results, params, "ClampNetwork");
+}
+
+std::shared_ptr<ngraph::Function> CompiledNetworkCacheTest::makeFunctionWithTensorIterator() const {
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 4, 16}, {1, 1, 16} });
+    auto X_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 16});
+    auto S_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 16});
+    auto S_o = std::make_shared<ngraph::opset1::Add>(X_t, S_t);
+    auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{S_o}, ngraph::ParameterVector{X_t, S_t});
+
+    auto tensorIterator = std::make_shared<ngraph::op::TensorIterator>();
+    tensorIterator->set_body(body);
+    tensorIterator->set_sliced_input(X_t, params[0], 0, 1, 1, -1, 1);
+    tensorIterator->set_merged_input(S_t, params[1], S_o);
+    auto out = tensorIterator->get_iter_value(S_o, -1);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(out) };
+    return std::make_shared<ngraph::Function>(results, params, "TensorIteratorNetwork");
+}
+
+TEST_P(ImportNetworkTest, CompareWithRefImpl) {
+    Run();
+};
+
+// Loads the same network twice: the first load compiles and stores the network, the second one imports it
+TEST_P(CompiledNetworkCacheTest, secondLoadIsImportedFromCache) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    ASSERT_EQ(cacheDir, ie.GetConfig(targetDevice, CONFIG_KEY(CACHE_DIR)).as<std::string>());
+
+    InferenceEngine::CNNNetwork cnnNetwork{function};
+    auto compiledNetwork = ie.LoadNetwork(cnnNetwork, targetDevice, configuration);
+    ASSERT_EQ(1u, CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+
+    auto cachedNetwork = ie.LoadNetwork(cnnNetwork, targetDevice, configuration);
+    ASSERT_EQ(1u, CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+
+    inputs.clear();
+    for (const auto& input : compiledNetwork.GetInputsInfo()) {
+        inputs.push_back(GenerateInput(*input.second));
+    }
+    ASSERT_EQ(CalculateOutputs(compiledNetwork), CalculateOutputs(cachedNetwork));
+
+    // a different configuration is a different cache entry
+    auto otherConfiguration = configuration;
+    otherConfiguration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+    ie.LoadNetwork(cnnNetwork, targetDevice, otherConfiguration);
+    ASSERT_EQ(2u, CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+}
+
+TEST_P(CompiledNetworkCacheTest, networksWithDifferentAttributesAreCachedSeparately) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+
+    InferenceEngine::CNNNetwork clampTo1{makeFunctionWithClamp(1.)};
+    InferenceEngine::CNNNetwork clampTo2{makeFunctionWithClamp(2.)};
+    ie.LoadNetwork(clampTo1, targetDevice, configuration);
+    ie.LoadNetwork(clampTo2, targetDevice, configuration);
+    ASSERT_EQ(2u, CommonTestUtils::listFilesWithExt(cacheDir, "blob").size());
+}
+
+TEST_P(CompiledNetworkCacheTest, networkWithTensorIteratorIsNotCached) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+
+    InferenceEngine::CNNNetwork cnnNetwork{makeFunctionWithTensorIterator()};
+    ASSERT_NO_THROW(ie.LoadNetwork(cnnNetwork, targetDevice, configuration));
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(cacheDir, "blob").empty());
+}
+
+namespace {
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+    InferenceEngine::Precision::FP32,
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {},
+    {{CONFIG_KEY(ENFORCE_BF16), CONFIG_VALUE(NO)}},
+};
+
+INSTANTIATE_TEST_CASE_P(ImportNetworkCase, ImportNetworkTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::ValuesIn(configs)),
+    ImportNetworkTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(CompiledNetworkCacheCase, CompiledNetworkCacheTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::ValuesIn(configs)),
+    ImportNetworkTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,59 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include <ie_plugin_config.hpp>
+
+#include "subgraph_tests/include/kernel_cache.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string KernelCacheTest::getTestCaseName(testing::TestParamInfo<std::string> obj) {
+    return "targetDevice=" + obj.param;
+}
+
+void KernelCacheTest::SetUp() {
+    targetDevice = this->GetParam();
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 16, 8, 8} });
+    auto mvn1 = ngraph::builder::makeMVN(params[0], false, true, 1e-9);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(mvn1);
+    auto mvn2 = ngraph::builder::makeMVN(relu, false, true, 1e-9);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(mvn2) };
+    function = std::make_shared<ngraph::Function>(results, params, "KernelCache");
+}
+
+unsigned int KernelCacheTest::GetMetric(const std::string& name) const {
+    return core->GetMetric(targetDevice, name).as<unsigned int>();
+}
+
+TEST_P(KernelCacheTest, reusesKernelsAcrossNetworks) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    // the kernels may be generated by the previous tests of the process
+    const auto hits = GetMetric(METRIC_KEY(KERNEL_CACHE_HITS));
+    const auto misses = GetMetric(METRIC_KEY(KERNEL_CACHE_MISSES));
+
+    Run();
+    const auto warmHits = GetMetric(METRIC_KEY(KERNEL_CACHE_HITS));
+    const auto warmMisses = GetMetric(METRIC_KEY(KERNEL_CACHE_MISSES));
+    ASSERT_GT(warmHits + warmMisses, hits + misses);
+
+    // the same network is compiled from the cached kernels only
+    auto warmNetwork = core->LoadNetwork(cnnNetwork, targetDevice, configuration);
+    warmNetwork.CreateInferRequest().Infer();
+    ASSERT_GT(GetMetric(METRIC_KEY(KERNEL_CACHE_HITS)), warmHits);
+    ASSERT_EQ(warmMisses, GetMetric(METRIC_KEY(KERNEL_CACHE_MISSES)));
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(KernelCache, KernelCacheTest,
+    ::testing::Values(CommonTestUtils::DEVICE_CPU),
+    KernelCacheTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
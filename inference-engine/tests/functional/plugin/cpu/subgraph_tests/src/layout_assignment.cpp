@@ -0,0 +1,91 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include <ngraph/variant.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "exec_graph_info.hpp"
+#include "subgraph_tests/include/layout_assignment.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+using InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT;
+
+}  // namespace
+
+std::string LayoutAssignmentTest::getTestCaseName(testing::TestParamInfo<layoutAssignmentParams> obj) {
+    std::string mode;
+    std::string targetDevice;
+    std::tie(mode, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "mode=" << mode << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+// A planar sum consumed by several convolutions: the greedy selection keeps the sum in the layout of
+// its inputs, so every convolution input is reordered to the blocked layout
+void LayoutAssignmentTest::SetUp() {
+    std::string mode;
+    std::tie(mode, targetDevice) = this->GetParam();
+    configuration[KEY_CPU_LAYOUT_ASSIGNMENT] = mode;
+    const size_t C = 32, H = 28, W = 28;
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, C, H, W}, {1, C, H, W} });
+    auto add = std::make_shared<ngraph::opset1::Add>(params[0], params[1]);
+    ngraph::ResultVector results;
+    for (size_t i = 0; i < 3; i++) {
+        auto conv = ngraph::builder::makeConvolution(add, ngraph::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, C);
+        results.push_back(std::make_shared<ngraph::opset1::Result>(conv));
+    }
+    function = std::make_shared<ngraph::Function>(results, params, "LayoutAssignment");
+}
+
+size_t LayoutAssignmentTest::CountReorders(InferenceEngine::ExecutableNetwork& network) const {
+    size_t reorders = 0;
+    auto execGraph = network.GetExecGraphInfo().getFunction();
+    IE_ASSERT(execGraph != nullptr);
+    for (const auto& op : execGraph->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        if (it == rtInfo.end())
+            continue;
+        auto type = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        if (type && type->get() == "Reorder")
+            reorders++;
+    }
+    return reorders;
+}
+
+TEST_P(LayoutAssignmentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the sum is produced in the blocked layout, so its reorders to the convolutions are gone
+    if (configuration[KEY_CPU_LAYOUT_ASSIGNMENT] == "GLOBAL") {
+        auto greedyConfiguration = configuration;
+        greedyConfiguration[KEY_CPU_LAYOUT_ASSIGNMENT] = "GREEDY";
+        auto greedyNetwork = core->LoadNetwork(cnnNetwork, targetDevice, greedyConfiguration);
+        ASSERT_LT(CountReorders(executableNetwork), CountReorders(greedyNetwork));
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(LayoutAssignment, LayoutAssignmentTest,
+    ::testing::Combine(
+        ::testing::Values("GREEDY", "GLOBAL"),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    LayoutAssignmentTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
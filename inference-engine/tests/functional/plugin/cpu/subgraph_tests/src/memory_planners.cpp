@@ -0,0 +1,131 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "common_test_utils/perf_utils.hpp"
+#include "subgraph_tests/include/memory_planners.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+using InferenceEngine::PluginConfigInternalParams::KEY_CPU_MEMORY_PLANNER;
+
+const std::map<std::string, std::function<std::shared_ptr<ngraph::Function>()>> models = {
+    {"ConvPoolRelu", [] { return ngraph::builder::subgraph::makeConvPoolRelu(); }},
+    {"SplitConvConcat", [] { return ngraph::builder::subgraph::makeSplitConvConcat(); }},
+    {"SplitMultiConvConcat", [] { return ngraph::builder::subgraph::makeSplitMultiConvConcat(); }},
+    {"TIwithLSTMcell", [] { return ngraph::builder::subgraph::makeTIwithLSTMcell(); }},
+    {"MultiSingleConv", [] { return ngraph::builder::subgraph::makeMultiSingleConv(); }},
+    {"NestedSplitConvConcat", [] { return ngraph::builder::subgraph::makeNestedSplitConvConcat(); }},
+    {"SplitConvConcatNestedInBranch", [] { return ngraph::builder::subgraph::makeSplitConvConcatNestedInBranch(); }},
+};
+
+}  // namespace
+
+std::string MemoryPlannersTest::getTestCaseName(testing::TestParamInfo<memoryPlannersParams> obj) {
+    std::string model;
+    std::string planner;
+    std::string targetDevice;
+    std::tie(model, planner, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "model=" << model << "_";
+    result << "planner=" << planner << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void MemoryPlannersTest::SetUp() {
+    std::string model;
+    std::string planner;
+    std::tie(model, planner, targetDevice) = this->GetParam();
+    configuration[KEY_CPU_MEMORY_PLANNER] = planner;
+    function = models.at(model)();
+}
+
+uint64_t MemoryPlannersTest::GetActivationsMemorySize(InferenceEngine::ExecutableNetwork& network) const {
+    return network.GetMetric(EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_SIZE)).as<uint64_t>();
+}
+
+TEST_P(MemoryPlannersTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto size = GetActivationsMemorySize(executableNetwork);
+    const auto lowerBound = executableNetwork.GetMetric(
+        EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_LOWER_BOUND)).as<uint64_t>();
+    ASSERT_GE(size, lowerBound);
+
+    // AUTO tries the greedy plan among the others, so it is never worse
+    if (configuration[KEY_CPU_MEMORY_PLANNER] == "AUTO") {
+        auto greedyConfiguration = configuration;
+        greedyConfiguration[KEY_CPU_MEMORY_PLANNER] = "GREEDY";
+        auto greedyNetwork = core->LoadNetwork(cnnNetwork, targetDevice, greedyConfiguration);
+        ASSERT_LE(size, GetActivationsMemorySize(greedyNetwork));
+    }
+}
+
+namespace {
+
+const std::vector<std::string> modelNames = {
+    "ConvPoolRelu",
+    "SplitConvConcat",
+    "SplitMultiConvConcat",
+    "TIwithLSTMcell",
+    "MultiSingleConv",
+    "NestedSplitConvConcat",
+    "SplitConvConcatNestedInBranch",
+};
+
+const std::vector<std::string> planners = {"GREEDY", "BEST_FIT", "INTERVAL_COLORING", "AUTO"};
+
+INSTANTIATE_TEST_CASE_P(MemoryPlanners, MemoryPlannersTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(modelNames),
+        ::testing::ValuesIn(planners),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    MemoryPlannersTest::getTestCaseName);
+
+}  // namespace
+
+// Benchmark: runs the planners over the test models and reports the planned activations memory
+// and the bytes saved compared to the greedy planner
+TEST(MemoryPlannersBenchmark, DISABLED_ActivationsMemoryFootprint) {
+    InferenceEngine::Core core;
+    std::map<std::string, uint64_t> total;
+    uint64_t totalLowerBound = 0;
+    for (const auto& model : modelNames) {
+        InferenceEngine::CNNNetwork network{models.at(model)()};
+        for (const auto& planner : planners) {
+            auto executableNetwork = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                                      {{KEY_CPU_MEMORY_PLANNER, planner}});
+            const auto size = executableNetwork.GetMetric(
+                EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_SIZE)).as<uint64_t>();
+            CommonTestUtils::reportPerf(model + " " + planner + " activations memory", size, "bytes");
+            total[planner] += size;
+            if (planner == planners.front()) {
+                totalLowerBound += executableNetwork.GetMetric(
+                    EXEC_NETWORK_METRIC_KEY(ACTIVATIONS_MEMORY_LOWER_BOUND)).as<uint64_t>();
+            }
+        }
+    }
+
+    CommonTestUtils::reportPerf("total lower bound", totalLowerBound, "bytes");
+    for (const auto& planner : planners) {
+        CommonTestUtils::reportPerf("total " + planner + " activations memory", total[planner], "bytes");
+        CommonTestUtils::reportPerf("total " + planner + " saved vs GREEDY",
+            static_cast<double>(total["GREEDY"]) - static_cast<double>(total[planner]), "bytes");
+    }
+}
+
+}  // namespace LayerTestsDefinitions
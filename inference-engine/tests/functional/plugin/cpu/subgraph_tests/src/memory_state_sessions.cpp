@@ -0,0 +1,168 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/perf_utils.hpp"
+#include "subgraph_tests/include/memory_state_sessions.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+const size_t C = 64;
+
+const float* data(const InferenceEngine::Blob::CPtr& blob) {
+    return blob->cbuffer().as<const float*>();
+}
+
+}  // namespace
+
+std::string MemoryStateSessionsTest::getTestCaseName(testing::TestParamInfo<memoryStateSessionsParams> obj) {
+    size_t numRequests;
+    size_t numSessions;
+    std::string targetDevice;
+    std::tie(numRequests, numSessions, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "requests=" << numRequests << "_";
+    result << "sessions=" << numSessions << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+// out = state + input, the sum becomes the new state
+void MemoryStateSessionsTest::SetUp() {
+    std::tie(numRequests, numSessions, targetDevice) = this->GetParam();
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+
+    auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C});
+    input->set_friendly_name("input");
+
+    auto init = std::make_shared<ngraph::op::Constant>(ngraph::element::f32, ngraph::Shape{1, C}, 0);
+    auto read = std::make_shared<ngraph::op::ReadValue>(init, "acc");
+    auto sum = std::make_shared<ngraph::opset1::Add>(read, input);
+    auto assign = std::make_shared<ngraph::op::Assign>(sum, "acc");
+    auto out = std::make_shared<ngraph::opset1::Relu>(sum);
+
+    // WA. Ngraph limitations. Assign should have control dependencies on read.
+    // And someone should hold assign node.
+    assign->add_control_dependency(read);
+    out->add_control_dependency(assign);
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{out}, ngraph::ParameterVector{input}, "Accumulator");
+}
+
+void MemoryStateSessionsTest::Prepare(std::vector<InferenceEngine::InferRequest>& requests) {
+    ConfigurePlugin();
+    LoadNetwork();
+
+    for (size_t r = 0; r < numRequests; r++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        ASSERT_EQ(1u, requests.back().QueryState().size());
+    }
+
+    const InferenceEngine::TensorDesc desc{InferenceEngine::Precision::FP32, {1, C}, InferenceEngine::Layout::NC};
+    inputs.clear();
+    for (size_t s = 0; s < numSessions; s++) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(desc, 10, static_cast<int32_t>(s % 5)));
+    }
+}
+
+void MemoryStateSessionsTest::RunSessions(std::vector<InferenceEngine::InferRequest>& requests,
+                                          std::vector<InferenceEngine::Blob::CPtr>& sessionStates, size_t steps) {
+    for (size_t step = 0; step < steps; step++) {
+        for (size_t first = 0; first < numSessions; first += numRequests) {
+            for (size_t r = 0; r < numRequests; r++) {
+                auto state = requests[r].QueryState().front();
+                if (sessionStates[first + r]) {
+                    state.SetState(std::const_pointer_cast<InferenceEngine::Blob>(sessionStates[first + r]));
+                } else {
+                    state.Reset();
+                }
+                requests[r].SetBlob("input", inputs[first + r]);
+                requests[r].StartAsync();
+            }
+            for (size_t r = 0; r < numRequests; r++) {
+                requests[r].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+                sessionStates[first + r] = requests[r].QueryState().front().GetLastState();
+            }
+        }
+    }
+}
+
+// Many streaming sessions are interleaved on a few requests of one network with several streams,
+// each request owns its states and the sessions are swapped in and out with SetState / GetLastState
+TEST_P(MemoryStateSessionsTest, interleavedSessionsKeepOwnStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t numSteps = 8;
+
+    std::vector<InferenceEngine::InferRequest> requests;
+    Prepare(requests);
+    if (HasFatalFailure()) {
+        return;
+    }
+    std::vector<InferenceEngine::Blob::CPtr> sessionStates(numSessions);
+    RunSessions(requests, sessionStates, numSteps);
+
+    for (size_t s = 0; s < numSessions; s++) {
+        ASSERT_EQ(C, sessionStates[s]->size());
+        std::vector<float> expected(data(inputs[s]), data(inputs[s]) + C);
+        for (auto& value : expected) {
+            value *= numSteps;
+        }
+        Compare(expected.data(), data(sessionStates[s]), C, threshold);
+    }
+
+    // the last session of each request is still bound to it, so the output matches its state
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+    for (size_t r = 0; r < numRequests; r++) {
+        Compare(data(sessionStates[numSessions - numRequests + r]), data(requests[r].GetBlob(outputName)), C, threshold);
+    }
+}
+
+// Benchmark: throughput of the sessions swapped in and out of the requests
+TEST_P(MemoryStateSessionsBenchmark, MeasureThroughput) {
+    const size_t numSteps = 32;
+
+    std::vector<InferenceEngine::InferRequest> requests;
+    Prepare(requests);
+    if (HasFatalFailure()) {
+        return;
+    }
+    std::vector<InferenceEngine::Blob::CPtr> sessionStates(numSessions);
+    // the first step allocates the states, so it is not measured
+    RunSessions(requests, sessionStates, 1);
+
+    using Clock = std::chrono::high_resolution_clock;
+    const auto start = Clock::now();
+    RunSessions(requests, sessionStates, numSteps);
+    const auto elapsed = CommonTestUtils::toMicroseconds(Clock::now() - start);
+    CommonTestUtils::reportPerf("throughput", 1e6 * numSessions * numSteps / elapsed, "inferences/s");
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(MemoryStateSessions, MemoryStateSessionsTest,
+    ::testing::Combine(
+        ::testing::Values(4),
+        ::testing::Values(64),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    MemoryStateSessionsTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(DISABLED_MemoryStateSessions, MemoryStateSessionsBenchmark,
+    ::testing::Combine(
+        ::testing::Values(4),
+        ::testing::Values(64, 1024),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    MemoryStateSessionsTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
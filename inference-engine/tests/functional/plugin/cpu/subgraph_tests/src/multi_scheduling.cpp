@@ -0,0 +1,95 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <multi-device/multi_device_config.hpp>
+
+#include "subgraph_tests/include/multi_scheduling.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string MultiSchedulingTest::getTestCaseName(testing::TestParamInfo<multiSchedulingParams> obj) {
+    std::string policy;
+    std::string device;
+    size_t devicesCount;
+    std::tie(policy, device, devicesCount) = obj.param;
+
+    std::ostringstream result;
+    result << "policy=" << policy << "_";
+    result << "device=" << device << "_";
+    result << "devicesCount=" << devicesCount;
+    return result.str();
+}
+
+void MultiSchedulingTest::SetUp() {
+    std::string policy;
+    std::string device;
+    size_t devicesCount;
+    std::tie(policy, device, devicesCount) = this->GetParam();
+    devices = devicesCount == 1 ? std::vector<std::string>{device}
+                                : CPUTestUtils::registerCPUDevices(core, device, devicesCount);
+    std::string priorities;
+    for (auto&& name : devices) {
+        priorities += (priorities.empty() ? "" : ",") + name;
+    }
+    targetDevice = CommonTestUtils::DEVICE_MULTI;
+    configuration[MULTI_CONFIG_KEY(DEVICE_PRIORITIES)] = priorities;
+    configuration[MULTI_CONFIG_KEY(SCHEDULING_POLICY)] = policy;
+    function = ngraph::builder::subgraph::makeConvPoolRelu();
+}
+
+// Keeps more requests in flight than the devices take, so they wait in the MULTI queue and are scheduled by the policy
+TEST_P(MultiSchedulingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto numRequests = executableNetwork.GetMetric(
+        METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (unsigned int i = 0; i < std::max(1u, numRequests) * 2; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(cnnNetwork.getInputsInfo().begin()->first, inputs.front());
+        requests.back().StartAsync();
+    }
+    const auto expectedOutputs = CalculateRefs();
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+    for (auto&& request : requests) {
+        ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+        Compare(expectedOutputs.front(), request.GetBlob(outputName));
+    }
+
+    auto queueDepth = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_QUEUE_DEPTH))
+        .as<std::map<std::string, unsigned int>>();
+    auto utilization = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_UTILIZATION))
+        .as<std::map<std::string, float>>();
+    auto latency = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_LATENCY))
+        .as<std::map<std::string, float>>();
+    // every device has executed some of the requests, so they were spread across the devices
+    for (auto&& device : devices) {
+        ASSERT_EQ(1, queueDepth.count(device)) << device;
+        EXPECT_EQ(0, queueDepth[device]) << device;
+        EXPECT_GT(utilization[device], 0.f) << device;
+        EXPECT_LE(utilization[device], 1.f) << device;
+        EXPECT_GT(latency[device], 0.f) << device;
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(MultiScheduling, MultiSchedulingTest,
+    ::testing::Combine(
+        ::testing::Values(MULTI_CONFIG_VALUE(PRIORITY), MULTI_CONFIG_VALUE(EARLIEST_COMPLETION)),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::Values(1, 2)),
+    MultiSchedulingTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,122 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <ie_plugin_config.hpp>
+
+#include "subgraph_tests/include/network_cache.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string NetworkCacheTest::getTestCaseName(testing::TestParamInfo<networkCacheParams> obj) {
+    std::string cacheSize;
+    std::string targetDevice;
+    std::tie(cacheSize, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "cacheSize=" << cacheSize << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void NetworkCacheTest::SetUp() {
+    std::string cacheSize;
+    std::tie(cacheSize, targetDevice) = this->GetParam();
+    // the cache and its metrics belong to a core, so the shared one is not used
+    core = std::make_shared<InferenceEngine::Core>();
+    configuration[CONFIG_KEY(NETWORK_CACHE_SIZE)] = cacheSize;
+    function = ngraph::builder::subgraph::makeConvReluChain({1, 8, 16, 16}, 4);
+    function->set_friendly_name("NetworkCache");
+}
+
+InferenceEngine::SizeVector NetworkCacheTest::LoadWithWidth(size_t width) {
+    const auto inputName = cnnNetwork.getInputsInfo().begin()->first;
+    cnnNetwork.reshape({{inputName, {1, 8, 16, width}}});
+    auto network = core->LoadNetwork(cnnNetwork, targetDevice);
+    network.CreateInferRequest().Infer();
+    return network.GetInputsInfo().begin()->second->getTensorDesc().getDims();
+}
+
+unsigned int NetworkCacheTest::GetCacheMetric(const std::string& name) const {
+    return core->GetMetric(targetDevice, name).as<unsigned int>();
+}
+
+TEST_P(NetworkCacheTest, reusesNetworksCompiledForSeenShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    ASSERT_EQ(configuration[CONFIG_KEY(NETWORK_CACHE_SIZE)],
+              core->GetConfig(targetDevice, CONFIG_KEY(NETWORK_CACHE_SIZE)).as<std::string>());
+
+    LoadWithWidth(24);
+    LoadWithWidth(16);
+    EXPECT_EQ(1, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_HITS)));
+    EXPECT_EQ(2, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_MISSES)));
+
+    // 24 is dropped as the least recently used network
+    LoadWithWidth(32);
+    LoadWithWidth(16);
+    LoadWithWidth(24);
+    EXPECT_EQ(2, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_HITS)));
+    EXPECT_EQ(4, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_MISSES)));
+    EXPECT_GT(core->GetMetric(targetDevice, METRIC_KEY(NETWORK_CACHE_COMPILE_TIME)).as<float>(), 0.f);
+}
+
+TEST_P(NetworkCacheTest, padsShapesUpToBuckets) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // widths are padded up to the buckets, so one compiled network serves several shapes
+    const auto inputName = cnnNetwork.getInputsInfo().begin()->first;
+    core->SetConfig({{CONFIG_KEY(SHAPE_BUCKETS), inputName + ":3:40,64"}}, targetDevice);
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 8, 16, 40}), LoadWithWidth(33));
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 8, 16, 40}), LoadWithWidth(37));
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 8, 16, 64}), LoadWithWidth(50));
+    EXPECT_EQ(InferenceEngine::SizeVector({1, 8, 16, 80}), LoadWithWidth(80));
+    EXPECT_EQ(1, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_HITS)));
+    EXPECT_EQ(4, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_MISSES)));
+
+    EXPECT_THROW(core->SetConfig({{CONFIG_KEY(SHAPE_BUCKETS), "wrong"}}, targetDevice),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_P(NetworkCacheTest, rejectsMalformedNumbers) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    for (auto&& value : {"in:x:40", "in:3:40,y", "in:3:40x", "in:-3:40", "in:3:99999999999999999999999"}) {
+        EXPECT_THROW(core->SetConfig({{CONFIG_KEY(SHAPE_BUCKETS), value}}, targetDevice),
+                     InferenceEngine::details::InferenceEngineException) << value;
+    }
+    for (auto&& value : {"x", "-1", "2x", "99999999999999999999999"}) {
+        EXPECT_THROW(core->SetConfig({{CONFIG_KEY(NETWORK_CACHE_SIZE), value}}, targetDevice),
+                     InferenceEngine::details::InferenceEngineException) << value;
+    }
+}
+
+// The plugin configuration is not a part of the cache key, so the networks compiled with the old one are dropped
+TEST_P(NetworkCacheTest, pluginConfigurationChangeDropsCachedNetworks) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    core->SetConfig({{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}, targetDevice);
+    LoadWithWidth(16);
+    EXPECT_EQ(0, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_HITS)));
+    EXPECT_EQ(2, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_MISSES)));
+
+    LoadWithWidth(16);
+    EXPECT_EQ(1, GetCacheMetric(METRIC_KEY(NETWORK_CACHE_HITS)));
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(NetworkCache, NetworkCacheTest,
+    ::testing::Combine(
+        ::testing::Values("2"),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    NetworkCacheTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
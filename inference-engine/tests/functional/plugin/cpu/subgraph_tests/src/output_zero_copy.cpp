@@ -0,0 +1,93 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "subgraph_tests/include/output_zero_copy.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string OutputZeroCopyTest::getTestCaseName(testing::TestParamInfo<outputZeroCopyParams> obj) {
+    InferenceEngine::Layout userLayout;
+    std::string targetDevice;
+    std::tie(userLayout, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "userLayout=" << userLayout << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void OutputZeroCopyTest::SetUp() {
+    std::tie(userLayout, targetDevice) = this->GetParam();
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {2, 16, 128, 128} });
+    auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, { 1, 1 }, { 1, 1 }, { 0, 0 }, { 0, 0 },
+        { 1, 1 }, ngraph::op::PadType::EXPLICIT, 32);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(relu) };
+    function = std::make_shared<ngraph::Function>(results, params, "OutputZeroCopy");
+}
+
+InferenceEngine::Blob::Ptr OutputZeroCopyTest::MakeUserOutput() const {
+    const auto& outputDesc = cnnNetwork.getOutputsInfo().begin()->second->getTensorDesc();
+    auto blob = make_blob_with_precision({outputDesc.getPrecision(), outputDesc.getDims(), userLayout});
+    blob->allocate();
+    return blob;
+}
+
+// The user blob of the same layout and precision is the output memory itself, otherwise the output is reordered
+// straight into it
+TEST_P(OutputZeroCopyTest, userOutputBlobIsBoundOrReordered) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+    const auto reference = GetOutputs().front();
+    auto output = MakeUserOutput();
+    inferRequest.SetBlob(outputName, output);
+    inferRequest.Infer();
+    ASSERT_EQ(output, inferRequest.GetBlob(outputName));
+    Compare(reference, FuncTestUtils::convertBlobLayout(output, reference->getTensorDesc().getLayout()));
+}
+
+TEST_P(OutputZeroCopyTest, userOutputBlobIsFilledWithDynamicBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const auto outputName = cnnNetwork.getOutputsInfo().begin()->first;
+    const auto reference = GetOutputs().front();
+    auto dynamicNetwork = core->LoadNetwork(cnnNetwork, targetDevice,
+                                            {{CONFIG_KEY(DYN_BATCH_ENABLED), CONFIG_VALUE(YES)}});
+    auto request = dynamicNetwork.CreateInferRequest();
+    request.SetBlob(cnnNetwork.getInputsInfo().begin()->first, inputs.front());
+    auto output = MakeUserOutput();
+    request.SetBlob(outputName, output);
+    request.SetBatch(1);
+    request.Infer();
+
+    // only the first batch is written
+    const auto actual = FuncTestUtils::convertBlobLayout(output, reference->getTensorDesc().getLayout());
+    const auto batchSize = reference->size() / reference->getTensorDesc().getDims()[0];
+    auto referenceBuffer = InferenceEngine::as<InferenceEngine::MemoryBlob>(reference)->rmap();
+    auto actualBuffer = InferenceEngine::as<InferenceEngine::MemoryBlob>(actual)->rmap();
+    Compare(referenceBuffer.as<const float*>(), actualBuffer.as<const float*>(), batchSize, threshold);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(OutputZeroCopy, OutputZeroCopyTest,
+    ::testing::Combine(
+        ::testing::Values(InferenceEngine::Layout::NCHW, InferenceEngine::Layout::NHWC),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    OutputZeroCopyTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,108 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+
+#include "subgraph_tests/include/parallel_branches.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string ParallelBranchesTest::getTestCaseName(testing::TestParamInfo<parallelBranchesParams> obj) {
+    size_t branches;
+    std::string parallelBranches;
+    std::string targetDevice;
+    std::tie(branches, parallelBranches, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "branches=" << branches << "_";
+    result << "parallel=" << parallelBranches << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void ParallelBranchesTest::SetUp() {
+    size_t branches;
+    std::string parallelBranches;
+    std::tie(branches, parallelBranches, targetDevice) = this->GetParam();
+    configuration[CONFIG_KEY(CPU_PARALLEL_BRANCHES)] = parallelBranches;
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 32, 28, 28} });
+    ngraph::OutputVector outputs;
+    for (size_t i = 0; i < branches; i++) {
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, { 1, 1 }, { 1, 1 }, { 0, 0 },
+            { 0, 0 }, { 1, 1 }, ngraph::op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+        auto conv2 = ngraph::builder::makeConvolution(relu, ngraph::element::f32, { 3, 3 }, { 1, 1 }, { 1, 1 },
+            { 1, 1 }, { 1, 1 }, ngraph::op::PadType::EXPLICIT, 16);
+        outputs.push_back(std::make_shared<ngraph::opset1::Relu>(conv2));
+    }
+    auto concat = ngraph::builder::makeConcat(outputs, 1);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(concat) };
+    function = std::make_shared<ngraph::Function>(results, params, "ParallelBranches");
+}
+
+TEST_P(ParallelBranchesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // The profile has the layers of the network and of the executed graph only
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    ASSERT_NE(nullptr, execGraph);
+    std::vector<std::string> layers;
+    for (const auto& graph : {function, execGraph}) {
+        for (const auto& op : graph->get_ops()) {
+            layers.push_back(op->get_friendly_name());
+        }
+    }
+    for (const auto& perfCount : inferRequest.GetPerformanceCounts()) {
+        EXPECT_NE(layers.end(), std::find(layers.begin(), layers.end(), perfCount.first)) << perfCount.first;
+    }
+}
+
+// The concurrency of the waves is measured only with the performance counters enabled
+TEST_P(ParallelBranchesTest, ReportsWavefrontExecution) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    const std::map<std::string, uint64_t> stats = executableNetwork.GetMetric(METRIC_KEY(WAVEFRONT_EXECUTION));
+    if (configuration[CONFIG_KEY(CPU_PARALLEL_BRANCHES)] != CONFIG_VALUE(YES)) {
+        ASSERT_TRUE(stats.empty());
+        return;
+    }
+    ASSERT_EQ(1u, stats.at(METRIC_VALUE(EXECUTIONS)));
+    ASSERT_LT(0u, stats.at(METRIC_VALUE(WAVES)));
+    ASSERT_LT(0u, stats.at(METRIC_VALUE(REAL_TIME_NS)));
+    ASSERT_LT(0u, stats.at(METRIC_VALUE(NODES_TIME_NS)));
+}
+
+TEST_P(ParallelBranchesTest, DoesNotTimeWavesWithoutPerfCounters) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(NO);
+    Run();
+
+    const std::map<std::string, uint64_t> stats = executableNetwork.GetMetric(METRIC_KEY(WAVEFRONT_EXECUTION));
+    ASSERT_TRUE(stats.empty());
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(ParallelBranches, ParallelBranchesTest,
+    ::testing::Combine(
+        ::testing::Values(1, 8),
+        ::testing::Values(CONFIG_VALUE(NO), CONFIG_VALUE(YES)),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    ParallelBranchesTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,100 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+
+#include "functional_test_utils/blob_utils.hpp"
+#include "subgraph_tests/include/preprocessing_normalization.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+const std::vector<float> means = {123.675f, 116.28f, 103.53f};
+const std::vector<float> scales = {1.f / 58.395f, 1.f / 57.12f, 1.f / 57.375f};
+
+}  // namespace
+
+std::string PreprocessingNormalizationTest::getTestCaseName(
+        testing::TestParamInfo<preprocessingNormalizationParams> obj) {
+    InferenceEngine::Layout layout;
+    std::map<std::string, std::string> configuration;
+    std::string targetDevice;
+    std::tie(layout, configuration, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "layout=" << layout << "_";
+    result << "targetDevice=" << targetDevice;
+    for (auto const& configItem : configuration) {
+        result << "_configItem=" << configItem.first << "_" << configItem.second;
+    }
+    return result.str();
+}
+
+void PreprocessingNormalizationTest::SetUp() {
+    std::tie(inLayout, configuration, targetDevice) = this->GetParam();
+    inPrc = InferenceEngine::Precision::U8;
+    // the graph may be executed in BF16, then both paths differ by its rounding
+    threshold = configuration.count(CONFIG_KEY(ENFORCE_BF16)) &&
+                configuration[CONFIG_KEY(ENFORCE_BF16)] == CONFIG_VALUE(YES) ? 2e-2f : 1e-3f;
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 3, 224, 224} });
+    auto conv = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, { 3, 3 }, { 2, 2 }, { 1, 1 }, { 1, 1 },
+        { 1, 1 }, ngraph::op::PadType::EXPLICIT, 8);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(conv) };
+    function = std::make_shared<ngraph::Function>(results, params, "PreprocessingNormalization");
+}
+
+InferenceEngine::Blob::Ptr PreprocessingNormalizationTest::InferWithResize(InferenceEngine::ResizeAlgorithm algorithm) {
+    cnnNetwork = InferenceEngine::CNNNetwork{function};
+    ConfigureNetwork();
+    auto inputInfo = cnnNetwork.getInputsInfo().begin()->second;
+    auto& preProcess = inputInfo->getPreProcess();
+    preProcess.init(means.size());
+    for (size_t c = 0; c < means.size(); c++) {
+        preProcess[c]->meanValue = means[c];
+        preProcess[c]->stdScale = scales[c];
+    }
+    preProcess.setVariant(InferenceEngine::MEAN_VALUE);
+    preProcess.setResizeAlgorithm(algorithm);
+
+    executableNetwork = core->LoadNetwork(cnnNetwork, targetDevice);
+    inferRequest = executableNetwork.CreateInferRequest();
+    if (inputs.empty()) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob(inputInfo->getTensorDesc()));
+    }
+    inferRequest.SetBlob(inputInfo->name(), inputs.front());
+    inferRequest.Infer();
+    return GetOutputs().front();
+}
+
+// Resize to the same size keeps the values, so the fused normalization differs from the mean image by the rounding
+TEST_P(PreprocessingNormalizationTest, fusedNormalizationMatchesMeanImage) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ConfigurePlugin();
+    const auto reference = InferWithResize(InferenceEngine::NO_RESIZE);
+    const auto actual = InferWithResize(InferenceEngine::RESIZE_BILINEAR);
+    Compare(reference, actual);
+}
+
+namespace {
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {},
+    {{CONFIG_KEY(ENFORCE_BF16), CONFIG_VALUE(YES)}},
+};
+
+INSTANTIATE_TEST_CASE_P(PreprocessingNormalization, PreprocessingNormalizationTest,
+    ::testing::Combine(
+        ::testing::Values(InferenceEngine::Layout::NCHW, InferenceEngine::Layout::NHWC),
+        ::testing::ValuesIn(configs),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    PreprocessingNormalizationTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,113 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+
+#include "subgraph_tests/include/request_tracing.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string RequestTracingTest::getTestCaseName(testing::TestParamInfo<requestTracingParams> obj) {
+    size_t numRequests;
+    std::string targetDevice;
+    std::tie(numRequests, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "requests=" << numRequests << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void RequestTracingTest::SetUp() {
+    std::tie(numRequests, targetDevice) = this->GetParam();
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+    function = ngraph::builder::subgraph::makeConvReluChain({1, 16, 28, 28});
+    function->set_friendly_name("RequestTracing");
+}
+
+void RequestTracingTest::TearDown() {
+    std::remove(traceFile.c_str());
+    std::remove(restartedTraceFile.c_str());
+}
+
+void RequestTracingTest::RunRequests(std::vector<InferenceEngine::InferRequest>& requests, size_t rounds) {
+    for (size_t i = 0; i < rounds; i++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+    }
+}
+
+TEST_P(RequestTracingTest, writesTimelineOfRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        for (const auto& input : cnnNetwork.getInputsInfo())
+            requests.back().SetBlob(input.first, GenerateInput(*input.second));
+        requests.back().SetCompletionCallback([] {});
+    }
+
+    core->SetConfig({{CONFIG_KEY(TRACE_FILE), traceFile}});
+    ASSERT_EQ(traceFile, core->GetConfig(targetDevice, CONFIG_KEY(TRACE_FILE)).as<std::string>());
+    RunRequests(requests, 4);
+    core->SetConfig({{CONFIG_KEY(TRACE_FILE), ""}});
+
+    std::ifstream file(traceFile);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream content;
+    content << file.rdbuf();
+    const auto trace = content.str();
+
+    ASSERT_EQ(0u, trace.find("{\"traceEvents\":["));
+    for (const auto& name : {"\"infer request\"", "\"queue wait\"", "\"Conv_0\"", "\"completion callback\""}) {
+        ASSERT_NE(std::string::npos, trace.find(name)) << name << " is not traced";
+    }
+}
+
+// Switching to another file while tracing writes the events of the running tracing to the previous file
+TEST_P(RequestTracingTest, restartWritesRunningTrace) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::vector<InferenceEngine::InferRequest> requests{executableNetwork.CreateInferRequest()};
+    for (const auto& input : cnnNetwork.getInputsInfo())
+        requests.back().SetBlob(input.first, GenerateInput(*input.second));
+
+    core->SetConfig({{CONFIG_KEY(TRACE_FILE), traceFile}});
+    RunRequests(requests, 1);
+    core->SetConfig({{CONFIG_KEY(TRACE_FILE), restartedTraceFile}});
+
+    std::ifstream file(traceFile);
+    ASSERT_TRUE(file.is_open());
+    std::stringstream content;
+    content << file.rdbuf();
+    EXPECT_NE(std::string::npos, content.str().find("\"infer request\""));
+
+    core->SetConfig({{CONFIG_KEY(TRACE_FILE), ""}});
+    EXPECT_TRUE(std::ifstream(restartedTraceFile).is_open());
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(RequestTracing, RequestTracingTest,
+    ::testing::Combine(
+        ::testing::Values(4),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    RequestTracingTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
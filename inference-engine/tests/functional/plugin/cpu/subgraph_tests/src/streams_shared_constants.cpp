@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+
+#include "subgraph_tests/include/streams_shared_constants.hpp"
+
+namespace LayerTestsDefinitions {
+
+std::string StreamsSharedConstantsTest::getTestCaseName(testing::TestParamInfo<streamsSharedConstantsParams> obj) {
+    size_t streams;
+    std::string targetDevice;
+    std::tie(streams, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "streams=" << streams << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void StreamsSharedConstantsTest::SetUp() {
+    std::tie(streams, targetDevice) = this->GetParam();
+    configuration[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = std::to_string(streams);
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, 16, 32, 32} });
+    auto conv1 = ngraph::builder::makeConvolution(params[0], ngraph::element::f32, { 3, 3 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+        { 1, 1 }, ngraph::op::PadType::EXPLICIT, 64);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(conv1);
+    auto conv2 = ngraph::builder::makeConvolution(relu, ngraph::element::f32, { 3, 3 }, { 1, 1 }, { 1, 1 }, { 1, 1 },
+        { 1, 1 }, ngraph::op::PadType::EXPLICIT, 64);
+    auto bias = ngraph::builder::makeConstant(ngraph::element::f32, { 1, 64, 1, 1 }, {}, true);
+    auto add = std::make_shared<ngraph::opset1::Add>(conv2, bias);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(add) };
+    function = std::make_shared<ngraph::Function>(results, params, "StreamsSharedConstants");
+}
+
+// Graphs of all streams share weights and constant data, so every stream has to produce the same results
+void StreamsSharedConstantsTest::InferConcurrently() {
+    const auto& expected = GetOutputs();
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < streams * 2; i++) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        requests.back().SetBlob(cnnNetwork.getInputsInfo().begin()->first, inputs.front());
+    }
+    for (int iteration = 0; iteration < 4; iteration++) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(InferenceEngine::StatusCode::OK, request.Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY));
+            Compare(expected.front(), request.GetBlob(cnnNetwork.getOutputsInfo().begin()->first));
+        }
+    }
+}
+
+TEST_P(StreamsSharedConstantsTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    InferConcurrently();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(StreamsSharedConstants, StreamsSharedConstantsTest,
+    ::testing::Combine(
+        ::testing::Values(1, 4),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    StreamsSharedConstantsTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,133 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <vector>
+
+#include <ngraph/variant.hpp>
+
+#include "exec_graph_info.hpp"
+#include "ie_parallel.hpp"
+#include "subgraph_tests/include/tensor_iterator_port_mapping.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+// The body has no back edges, so the iterations are independent and the sliced ports are mapped in place
+std::shared_ptr<ngraph::Function> makeMapBody() {
+    const size_t T = 64, C = 256;
+    std::vector<float> weights(C * C);
+    for (size_t i = 0; i < weights.size(); i++) {
+        weights[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / C;
+    }
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {T, C}, {T, C} });
+    auto X_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C});
+    auto Y_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, C});
+    auto sum = std::make_shared<ngraph::opset1::Add>(X_t, Y_t);
+    auto W = ngraph::builder::makeConstant(ngraph::element::f32, {C, C}, weights);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(sum, W);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(matMul);
+    auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{relu}, ngraph::ParameterVector{X_t, Y_t});
+
+    auto tensorIterator = std::make_shared<ngraph::op::TensorIterator>();
+    tensorIterator->set_body(body);
+    tensorIterator->set_sliced_input(X_t, params[0], 0, 1, 1, -1, 0);
+    // Y is iterated in the reverse order
+    tensorIterator->set_sliced_input(Y_t, params[1], -1, -1, 1, 0, 0);
+    auto out = tensorIterator->get_concatenated_slices(relu, 0, 1, 1, -1, 0);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(out) };
+    return std::make_shared<ngraph::Function>(results, params, "TensorIteratorMap");
+}
+
+// The running sum goes through the back edge, so the iterations are executed sequentially
+std::shared_ptr<ngraph::Function> makeScanBody() {
+    const size_t T = 32, C = 16;
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, { {1, T, C}, {1, 1, C} });
+    auto X_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, C});
+    auto S_t = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, C});
+    auto S_o = std::make_shared<ngraph::opset1::Add>(X_t, S_t);
+    auto body = std::make_shared<ngraph::Function>(ngraph::OutputVector{S_o}, ngraph::ParameterVector{X_t, S_t});
+
+    auto tensorIterator = std::make_shared<ngraph::op::TensorIterator>();
+    tensorIterator->set_body(body);
+    tensorIterator->set_sliced_input(X_t, params[0], 0, 1, 1, -1, 1);
+    tensorIterator->set_merged_input(S_t, params[1], S_o);
+    auto out = tensorIterator->get_concatenated_slices(S_o, 0, 1, 1, -1, 1);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(out) };
+    return std::make_shared<ngraph::Function>(results, params, "TensorIteratorScan");
+}
+
+}  // namespace
+
+std::string TensorIteratorPortMappingTest::getTestCaseName(testing::TestParamInfo<tensorIteratorPortMappingParams> obj) {
+    std::string bodyType;
+    std::string targetDevice;
+    std::tie(bodyType, targetDevice) = obj.param;
+
+    std::ostringstream result;
+    result << "body=" << bodyType << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void TensorIteratorPortMappingTest::SetUp() {
+    std::tie(bodyType, targetDevice) = this->GetParam();
+    function = bodyType == "Map" ? makeMapBody() : makeScanBody();
+}
+
+std::map<std::string, std::string> TensorIteratorPortMappingTest::GetTensorIteratorInfo() {
+    std::map<std::string, std::string> info;
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    IE_ASSERT(execGraph != nullptr);
+    for (const auto& op : execGraph->get_ops()) {
+        auto& rtInfo = op->get_rt_info();
+        auto layerType = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        if (layerType == rtInfo.end() ||
+            std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(layerType->second)->get() != "TensorIterator") {
+            continue;
+        }
+        for (const auto& item : rtInfo) {
+            if (auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(item.second)) {
+                info[item.first] = value->get();
+            }
+        }
+    }
+    return info;
+}
+
+TEST_P(TensorIteratorPortMappingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    auto info = GetTensorIteratorInfo();
+    ASSERT_EQ(1u, info.count("bodyReplicas"));
+    ASSERT_EQ(1u, info.count("inPlacePorts"));
+    const auto replicas = std::stoi(info["bodyReplicas"]);
+    const auto inPlacePorts = std::stoi(info["inPlacePorts"]);
+
+    ASSERT_GT(inPlacePorts, 0);
+    if (bodyType == "Map") {
+        if (parallel_get_max_threads() > 1) {
+            ASSERT_GT(replicas, 1);
+        }
+    } else {
+        ASSERT_EQ(1, replicas);
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(TensorIteratorPortMapping, TensorIteratorPortMappingTest,
+    ::testing::Combine(
+        ::testing::Values("Map", "Scan"),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+    TensorIteratorPortMappingTest::getTestCaseName);
+
+}  // namespace
+
+}  // namespace LayerTestsDefinitions
@@ -132,4 +132,15 @@ std::map<std::string, std::shared_ptr<ngraph::Variant>> CPUTestsBase::setCPUInfo
     return cpuInfo;
 }
 
+std::vector<std::string> registerCPUDevices(std::shared_ptr<InferenceEngine::Core>& core, const std::string& device,
+                                            size_t count) {
+    core = std::make_shared<InferenceEngine::Core>();
+    std::vector<std::string> devices;
+    for (size_t i = 0; i < count; i++) {
+        devices.push_back(device + std::to_string(i));
+        core->RegisterPlugin("MKLDNNPlugin", devices.back());
+    }
+    return devices;
+}
+
 } // namespace CPUTestUtils
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 #include <ngraph/variant.hpp>
 #include "ie_system_conf.h"
 #include "functional_test_utils/layer_test_utils.hpp"
@@ -58,6 +60,14 @@ const auto conv_ref_3D = CPUSpecificParams{{ncdhw}, {ncdhw}, {"ref_any"}, "ref_a
 const auto conv_gemm_2D = CPUSpecificParams{{nchw}, {nchw}, {"gemm_any"}, "jit_gemm_FP32"};
 const auto conv_gemm_3D = CPUSpecificParams{{ncdhw}, {ncdhw}, {"gemm_any"}, "jit_gemm_FP32"};
 
+/**
+ * Registers the CPU plugin under the names device + "0", device + "1", ... in a new core, so that HETERO and MULTI
+ * get several devices to choose from and the shared core is not affected
+ * @return The registered device names
+ */
+std::vector<std::string> registerCPUDevices(std::shared_ptr<InferenceEngine::Core>& core, const std::string& device,
+                                            size_t count);
+
 const auto conv_sse42_2D = CPUSpecificParams{{nChw8c}, {nChw8c}, {"jit_sse42"}, "jit_sse42_FP32"};
 const auto conv_sse42_3D = CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {"jit_sse42"}, "jit_sse42_FP32"};
 const auto conv_sse42_dw_2D = CPUSpecificParams{{nChw8c}, {nChw8c}, {"jit_sse42_dw"}, "jit_sse42_dw_FP32"};
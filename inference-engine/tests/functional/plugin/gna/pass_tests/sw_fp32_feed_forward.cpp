@@ -0,0 +1,139 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/perf_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+typedef std::tuple<
+    size_t,                             // Frames per request
+    std::vector<size_t>,                // Sizes of the layers: input, hidden..., output
+    std::string,                        // Target Device
+    std::map<std::string, std::string>  // Configuration
+> swFp32FeedForwardParams;
+
+namespace LayerTestsDefinitions {
+
+// Feed forward acoustic model similar to the models of the speech sample, every hidden layer is
+// the affine component followed by the sigmoid
+class SwFp32FeedForwardTest : public testing::WithParamInterface<swFp32FeedForwardParams>,
+                            public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<swFp32FeedForwardParams> obj) {
+        size_t frames;
+        std::vector<size_t> layers;
+        std::string targetDevice;
+        std::map<std::string, std::string> configuration;
+        std::tie(frames, layers, targetDevice, configuration) = obj.param;
+
+        std::ostringstream result;
+        result << "frames=" << frames << "_";
+        result << "layers=" << CommonTestUtils::vec2str(layers) << "_";
+        result << "targetDevice=" << targetDevice;
+        for (auto const& configItem : configuration) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> layers;
+        std::tie(_frames, layers, targetDevice, configuration) = this->GetParam();
+        // The blocked FMA kernels sum the products of the affine layers in another order than
+        // the reference, so the results differ by the rounding. For 2048 products the bound is
+        // n * eps * sum|w * x| ~ 2048 * 6e-8 * 5 ~ 6e-4, the sigmoids damp it between the layers.
+        threshold = 1e-3f;
+
+        auto params = ngraph::builder::makeParams(ngraph::element::f32, { {_frames, layers.front()} });
+        std::shared_ptr<ngraph::Node> last = params[0];
+        for (size_t i = 1; i < layers.size(); ++i) {
+            // small deterministic weights keep the sigmoids out of the saturation
+            std::vector<float> weights(layers[i - 1] * layers[i]);
+            for (size_t j = 0; j < weights.size(); ++j) {
+                weights[j] = 0.01f * static_cast<float>(static_cast<int>(j % 17) - 8) / 8.0f;
+            }
+            std::vector<float> biases(layers[i]);
+            for (size_t j = 0; j < biases.size(); ++j) {
+                biases[j] = 0.1f * static_cast<float>(static_cast<int>(j % 5) - 2);
+            }
+            auto weightsNode = ngraph::builder::makeConstant(ngraph::element::f32, {layers[i - 1], layers[i]}, weights);
+            auto biasesNode = ngraph::builder::makeConstant(ngraph::element::f32, {1, layers[i]}, biases);
+            last = std::make_shared<ngraph::opset1::Add>(
+                std::make_shared<ngraph::opset1::MatMul>(last, weightsNode, false, false), biasesNode);
+            if (i + 1 < layers.size()) {
+                last = std::make_shared<ngraph::opset1::Sigmoid>(last);
+            }
+        }
+        ngraph::ResultVector results{ std::make_shared<ngraph::opset1::Result>(last) };
+        function = std::make_shared<ngraph::Function>(results, params, "SwFp32FeedForward");
+    }
+
+    size_t _frames = 1;
+};
+
+class SwFp32FeedForwardBenchmark : public SwFp32FeedForwardTest {};
+
+TEST_P(SwFp32FeedForwardTest, CompareWithRefImpl) {
+    Run();
+};
+
+// Benchmark: frame rate of the speech-like models, the results are compared with the reference first
+TEST_P(SwFp32FeedForwardBenchmark, MeasureFrameRate) {
+    Run();
+    if (HasFailure()) {
+        return;
+    }
+
+    using Clock = std::chrono::high_resolution_clock;
+    const int iterations = 20;
+    const auto start = Clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        inferRequest.Infer();
+    }
+    const auto elapsed = CommonTestUtils::toMicroseconds(Clock::now() - start);
+    CommonTestUtils::reportPerf("frame rate", 1e6 * iterations * _frames / elapsed, "frames/s");
+}
+
+const std::vector<std::vector<size_t>> layers = {
+    {440, 2048, 2048, 2048, 2048, 2048, 3425},
+    {440, 768, 768, 768, 768, 3425}
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {
+        {"GNA_DEVICE_MODE", "GNA_SW_FP32"}
+    }
+};
+
+INSTANTIATE_TEST_CASE_P(SwFp32FeedForward, SwFp32FeedForwardTest,
+    ::testing::Combine(
+        ::testing::Values(1, 8),
+        ::testing::ValuesIn(layers),
+        ::testing::Values(CommonTestUtils::DEVICE_GNA),
+        ::testing::ValuesIn(configs)),
+    SwFp32FeedForwardTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(DISABLED_SwFp32FrameRate, SwFp32FeedForwardBenchmark,
+    ::testing::Combine(
+        ::testing::Values(1, 8),
+        ::testing::ValuesIn(layers),
+        ::testing::Values(CommonTestUtils::DEVICE_GNA),
+        ::testing::ValuesIn(configs)),
+    SwFp32FeedForwardTest::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
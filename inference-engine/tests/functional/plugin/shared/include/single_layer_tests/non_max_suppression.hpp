@@ -0,0 +1,51 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+
+namespace LayerTestsDefinitions {
+
+using NmsInputShapeParams = std::tuple<
+    size_t,     // Number of batches
+    size_t,     // Number of boxes
+    size_t      // Number of classes
+>;
+
+using NmsParams = std::tuple<
+    NmsInputShapeParams,
+    int32_t,        // Max output boxes per class
+    float,          // IOU threshold
+    float,          // Score threshold
+    std::string     // Device name
+>;
+
+// Boxes are clustered around a few centers, so that many of them overlap. The reference is a straightforward
+// greedy NMS which orders the output by batch, class and selection order.
+class NmsLayerTest : public testing::WithParamInterface<NmsParams>, virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<NmsParams> obj);
+    void Infer() override;
+    std::vector<std::vector<std::uint8_t>> CalculateRefs() override;
+
+protected:
+    void SetUp() override;
+
+    size_t numBatches, numBoxes, numClasses;
+    int32_t maxOutBoxesPerClass;
+    float iouThreshold, scoreThreshold;
+    std::vector<float> boxes, scores;
+};
+
+// Benchmark: time of the inference compared to the scalar reference
+class NmsLayerBenchmark : public NmsLayerTest {};
+
+}  // namespace LayerTestsDefinitions
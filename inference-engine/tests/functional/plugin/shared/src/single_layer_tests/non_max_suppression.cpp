@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <utility>
+
+#include <ngraph/opsets/opset4.hpp>
+
+#include "common_test_utils/perf_utils.hpp"
+#include "single_layer_tests/non_max_suppression.hpp"
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+float intersectionOverUnion(const float* i, const float* j) {
+    const float areaI = (i[2] - i[0]) * (i[3] - i[1]);
+    const float areaJ = (j[2] - j[0]) * (j[3] - j[1]);
+    const float intersection = std::max(std::min(i[2], j[2]) - std::max(i[0], j[0]), 0.f) *
+                               std::max(std::min(i[3], j[3]) - std::max(i[1], j[1]), 0.f);
+    return intersection / (areaI + areaJ - intersection);
+}
+
+}  // namespace
+
+std::string NmsLayerTest::getTestCaseName(testing::TestParamInfo<NmsParams> obj) {
+    NmsInputShapeParams inShapeParams;
+    int32_t maxOutBoxesPerClass;
+    float iouThreshold, scoreThreshold;
+    std::string targetDevice;
+    std::tie(inShapeParams, maxOutBoxesPerClass, iouThreshold, scoreThreshold, targetDevice) = obj.param;
+
+    size_t numBatches, numBoxes, numClasses;
+    std::tie(numBatches, numBoxes, numClasses) = inShapeParams;
+
+    std::ostringstream result;
+    result << "numBatches=" << numBatches << "_numBoxes=" << numBoxes << "_numClasses=" << numClasses << "_";
+    result << "maxOutBoxesPerClass=" << maxOutBoxesPerClass << "_";
+    result << "iouThr=" << iouThreshold << "_scoreThr=" << scoreThreshold << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void NmsLayerTest::SetUp() {
+    NmsInputShapeParams inShapeParams;
+    std::tie(inShapeParams, maxOutBoxesPerClass, iouThreshold, scoreThreshold, targetDevice) = this->GetParam();
+    std::tie(numBatches, numBoxes, numClasses) = inShapeParams;
+
+    auto boxesParam = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32,
+                                                                  ngraph::Shape{numBatches, numBoxes, 4});
+    boxesParam->set_friendly_name("boxes");
+    auto scoresParam = std::make_shared<ngraph::opset4::Parameter>(ngraph::element::f32,
+                                                                   ngraph::Shape{numBatches, numClasses, numBoxes});
+    scoresParam->set_friendly_name("scores");
+    auto maxOutput = ngraph::opset4::Constant::create(ngraph::element::i32, ngraph::Shape{}, {maxOutBoxesPerClass});
+    auto iouThr = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{}, {iouThreshold});
+    auto scoreThr = ngraph::opset4::Constant::create(ngraph::element::f32, ngraph::Shape{}, {scoreThreshold});
+    auto nms = std::make_shared<ngraph::opset4::NonMaxSuppression>(boxesParam, scoresParam, maxOutput, iouThr, scoreThr,
+        ngraph::opset4::NonMaxSuppression::BoxEncodingType::CORNER, false, ngraph::element::i32);
+    ngraph::ResultVector results{ std::make_shared<ngraph::opset4::Result>(nms) };
+    function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{boxesParam, scoresParam}, "NMS");
+}
+
+void NmsLayerTest::Infer() {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> center(0.f, 1000.f), jitter(-8.f, 8.f), size(16.f, 64.f), score(0.f, 1.f);
+    std::vector<std::pair<float, float>> clusters(64);
+    for (auto& cluster : clusters)
+        cluster = {center(gen), center(gen)};
+
+    boxes.resize(numBatches * numBoxes * 4);
+    for (size_t i = 0; i < boxes.size() / 4; i++) {
+        const auto& cluster = clusters[i % clusters.size()];
+        const float y = cluster.first + jitter(gen), x = cluster.second + jitter(gen);
+        boxes[4 * i + 0] = y;
+        boxes[4 * i + 1] = x;
+        boxes[4 * i + 2] = y + size(gen);
+        boxes[4 * i + 3] = x + size(gen);
+    }
+    scores.resize(numBatches * numClasses * numBoxes);
+    for (auto& value : scores)
+        value = score(gen);
+
+    inferRequest = executableNetwork.CreateInferRequest();
+    inputs.clear();
+    for (const auto& input : cnnNetwork.getInputsInfo()) {
+        const auto& info = input.second;
+        auto& data = info->name() == "boxes" ? boxes : scores;
+        auto blob = InferenceEngine::make_shared_blob<float>(info->getTensorDesc(), data.data());
+        inferRequest.SetBlob(info->name(), blob);
+        inputs.push_back(blob);
+    }
+    inferRequest.Infer();
+}
+
+std::vector<std::vector<std::uint8_t>> NmsLayerTest::CalculateRefs() {
+    std::vector<int32_t> selectedIndices;
+    for (size_t b = 0; b < numBatches; b++) {
+        for (size_t c = 0; c < numClasses; c++) {
+            const float* classScores = &scores[(b * numClasses + c) * numBoxes];
+            std::vector<int32_t> order;
+            for (size_t i = 0; i < numBoxes; i++)
+                if (classScores[i] > scoreThreshold)
+                    order.push_back(static_cast<int32_t>(i));
+            std::stable_sort(order.begin(), order.end(), [&](int32_t l, int32_t r) {
+                return classScores[l] > classScores[r];
+            });
+
+            std::vector<int32_t> selected;
+            for (auto i : order) {
+                if (static_cast<int32_t>(selected.size()) >= maxOutBoxesPerClass)
+                    break;
+                bool suppressed = std::any_of(selected.begin(), selected.end(), [&](int32_t j) {
+                    return intersectionOverUnion(&boxes[(b * numBoxes + i) * 4],
+                                                 &boxes[(b * numBoxes + j) * 4]) > iouThreshold;
+                });
+                if (!suppressed)
+                    selected.push_back(i);
+            }
+            for (auto i : selected)
+                selectedIndices.insert(selectedIndices.end(), {static_cast<int32_t>(b), static_cast<int32_t>(c), i});
+        }
+    }
+
+    // the rest of the output is filled with -1
+    const auto outputSize = GetOutputs().front()->size();
+    EXPECT_LE(selectedIndices.size(), outputSize);
+    selectedIndices.resize(outputSize, -1);
+    const auto bytes = reinterpret_cast<const std::uint8_t*>(selectedIndices.data());
+    return {std::vector<std::uint8_t>(bytes, bytes + selectedIndices.size() * sizeof(int32_t))};
+}
+
+TEST_P(NmsLayerTest, CompareWithRefs) {
+    Run();
+}
+
+TEST_P(NmsLayerBenchmark, MeasureInferenceTime) {
+    Run();
+
+    using Clock = std::chrono::high_resolution_clock;
+    const int iterations = 10;
+    const auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        inferRequest.Infer();
+    }
+    const auto inferenceTime = (Clock::now() - start) / iterations;
+
+    const auto referenceStart = Clock::now();
+    CalculateRefs();
+    const auto referenceTime = Clock::now() - referenceStart;
+
+    CommonTestUtils::reportPerf("inference time", CommonTestUtils::toMicroseconds(inferenceTime), "us");
+    CommonTestUtils::reportPerf("scalar reference time", CommonTestUtils::toMicroseconds(referenceTime), "us");
+}
+
+}  // namespace LayerTestsDefinitions
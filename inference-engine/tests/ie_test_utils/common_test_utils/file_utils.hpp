@@ -3,10 +3,23 @@
 //
 #pragma once
 
+#include <cstdio>
 #include <fstream>
 #include <string>
 #include <vector>
 
+#ifdef _WIN32
+#include <direct.h>
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "test_constants.hpp"
 
 namespace CommonTestUtils {
@@ -62,4 +75,55 @@ inline void removeIRFiles(const std::string &xmlFilePath, const std::string &bin
         std::remove(binFileName.c_str());
     }
 }
+
+inline void createDirectory(const std::string& dirPath) {
+#ifdef _WIN32
+    _mkdir(dirPath.c_str());
+#else
+    mkdir(dirPath.c_str(), 0755);
+#endif
+}
+
+inline void removeDir(const std::string& dirPath) {
+#ifdef _WIN32
+    _rmdir(dirPath.c_str());
+#else
+    rmdir(dirPath.c_str());
+#endif
+}
+
+inline std::vector<std::string> listFilesWithExt(const std::string& dirPath, const std::string& ext) {
+    std::vector<std::string> result;
+    auto hasExt = [&ext] (const std::string& name) {
+        return name.size() > ext.size() + 1 && 0 == name.compare(name.size() - ext.size() - 1, std::string::npos, "." + ext);
+    };
+#ifdef _WIN32
+    WIN32_FIND_DATAA data;
+    HANDLE handle = FindFirstFileA(makePath(dirPath, "*").c_str(), &data);
+    if (INVALID_HANDLE_VALUE != handle) {
+        do {
+            if (hasExt(data.cFileName)) {
+                result.push_back(makePath(dirPath, data.cFileName));
+            }
+        } while (FindNextFileA(handle, &data));
+        FindClose(handle);
+    }
+#else
+    if (DIR* dir = opendir(dirPath.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            if (hasExt(entry->d_name)) {
+                result.push_back(makePath(dirPath, entry->d_name));
+            }
+        }
+        closedir(dir);
+    }
+#endif
+    return result;
+}
+
+inline void removeFilesWithExt(const std::string& dirPath, const std::string& ext) {
+    for (auto&& file : listFilesWithExt(dirPath, ext)) {
+        std::remove(file.c_str());
+    }
+}
 }  // namespace CommonTestUtils
@@ -0,0 +1,54 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "perf_utils.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define _WINSOCKAPI_
+
+#include <windows.h>
+#include "Psapi.h"
+#endif
+
+namespace CommonTestUtils {
+
+void reportPerf(const std::string& name, double value, const std::string& unit) {
+    ::testing::Test::RecordProperty(name, std::to_string(value) + " " + unit);
+    std::cout << "[ PERF     ] " << name << ": " << value << " " << unit << std::endl;
+}
+
+size_t getResidentSetSizeInKB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    pmc.cb = sizeof(PROCESS_MEMORY_COUNTERS);
+    GetProcessMemoryInfo(GetCurrentProcess(), &pmc, pmc.cb);
+    return pmc.WorkingSetSize / 1024;
+#else
+    FILE *file = fopen("/proc/self/status", "r");
+    size_t result = 0;
+    if (file != nullptr) {
+        char line[128];
+        while (fgets(line, sizeof(line), file) != NULL) {
+            if (strncmp(line, "VmRSS:", 6) == 0) {
+                result = static_cast<size_t>(atol(line + 6));
+                break;
+            }
+        }
+        fclose(file);
+    }
+    return result;
+#endif
+}
+
+}  // namespace CommonTestUtils
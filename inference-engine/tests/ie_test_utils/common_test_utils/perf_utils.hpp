@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace CommonTestUtils {
+
+/**
+ * Prints a measured value and records it as a property of the current test in the XML report.
+ * Benchmarks are instantiated with the DISABLED_ prefix, so they are skipped by default and
+ * run with --gtest_also_run_disabled_tests. The measured values are never asserted.
+ */
+void reportPerf(const std::string& name, double value, const std::string& unit);
+
+/**
+ * Returns the resident set size of the process in kilobytes or 0 if it is unknown
+ */
+size_t getResidentSetSizeInKB();
+
+/**
+ * Returns the duration in microseconds
+ */
+template <typename Duration>
+inline double toMicroseconds(const Duration& duration) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(duration).count();
+}
+
+}  // namespace CommonTestUtils
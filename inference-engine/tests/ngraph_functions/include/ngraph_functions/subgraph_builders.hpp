@@ -464,6 +464,27 @@ static std::shared_ptr<ngraph::Function> makeConvBias(std::vector<size_t> inputS
     fn_ptr->set_friendly_name("ConvBias");
     return fn_ptr;
 }
+
+// A chain of 3x3 convolutions which keep the number of channels, every convolution is followed by ReLU.
+// The nodes are named Conv_<i> and Relu_<i>.
+static std::shared_ptr<ngraph::Function> makeConvReluChain(std::vector<size_t> inputShape = {1, 16, 28, 28},
+                                                           size_t convolutions = 1,
+                                                           InferenceEngine::Precision prc = InferenceEngine::Precision::FP32) {
+    auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(prc);
+    auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+    std::shared_ptr<ngraph::Node> last = params[0];
+    for (size_t i = 0; i < convolutions; i++) {
+        auto conv = ngraph::builder::makeConvolution(last, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ngraph::op::PadType::EXPLICIT, inputShape[1]);
+        conv->set_friendly_name("Conv_" + std::to_string(i));
+        last = std::make_shared<ngraph::opset1::Relu>(conv);
+        last->set_friendly_name("Relu_" + std::to_string(i));
+    }
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(last)};
+    std::shared_ptr<ngraph::Function> fnPtr = std::make_shared<ngraph::Function>(results, params);
+    fnPtr->set_friendly_name("ConvReluChain");
+    return fnPtr;
+}
 }  // namespace subgraph
 }  // namespace builder
 }  // namespace ngraph
@@ -2,6 +2,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -273,3 +278,130 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+
+using Planner = MKLDNNPlugin::MemorySolver::Planner;
+
+class MemSolverPlannerTest : public ::testing::TestWithParam<Planner> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<Planner>& obj) {
+        switch (obj.param) {
+            case Planner::Greedy: return "Greedy";
+            case Planner::BestFit: return "BestFit";
+            case Planner::IntervalColoring: return "IntervalColoring";
+            case Planner::Optimal: return "Optimal";
+            case Planner::Auto: return "Auto";
+        }
+        return "";
+    }
+
+protected:
+    static void checkNoOverlapping(const MKLDNNPlugin::MemorySolver& ms, const std::vector<Box>& boxes, int64_t total) {
+        for (size_t i = 0; i < boxes.size(); i++) {
+            ASSERT_GE(ms.getOffset(boxes[i].id), 0);
+            ASSERT_LE(ms.getOffset(boxes[i].id) + boxes[i].size, total);
+            for (size_t j = i + 1; j < boxes.size(); j++) {
+                auto finish1 = boxes[i].finish == -1 ? std::numeric_limits<int>::max() : boxes[i].finish;
+                auto finish2 = boxes[j].finish == -1 ? std::numeric_limits<int>::max() : boxes[j].finish;
+                auto off1 = ms.getOffset(boxes[i].id);
+                auto off2 = ms.getOffset(boxes[j].id);
+                ASSERT_TRUE(finish1 < boxes[j].start || boxes[i].start > finish2 ||
+                            off1 + boxes[i].size <= off2 || off1 >= off2 + boxes[j].size)
+                    << "Box overlapping is detected";
+            }
+        }
+    }
+};
+
+TEST_P(MemSolverPlannerTest, RandomBoxesHaveNoOverlapping) {
+    std::mt19937 gen(42);
+    for (int iteration = 0; iteration < 20; iteration++) {
+        std::vector<Box> boxes;
+        const int num = 1 + iteration * 5;
+        for (int i = 0; i < num; i++) {
+            int start = std::uniform_int_distribution<int>(0, num)(gen);
+            int finish = start + std::uniform_int_distribution<int>(0, 5)(gen);
+            if (i % 7 == 0) finish = -1;
+            boxes.push_back({start, finish, std::uniform_int_distribution<int64_t>(1, 100)(gen), i});
+        }
+
+        MKLDNNPlugin::MemorySolver ms(boxes, GetParam());
+        auto total = ms.solve();
+        ASSERT_GE(total, ms.maxDepth());
+        checkNoOverlapping(ms, boxes, total);
+    }
+}
+
+TEST_P(MemSolverPlannerTest, LinearTopologyIsOptimal) {
+    // First fit may leave a gap which is too small for the next box
+    if (GetParam() == Planner::IntervalColoring)
+        return;
+
+    int n = 0;
+    std::vector<Box> boxes;
+    for (int64_t size : {3, 96, 96, 96, 27, 256, 256, 13, 384, 384, 6, 4069, 4069, 1000})
+        boxes.push_back({n, ++n, size, n});
+
+    MKLDNNPlugin::MemorySolver ms(boxes, GetParam());
+    EXPECT_EQ(ms.solve(), ms.maxDepth());
+    checkNoOverlapping(ms, boxes, ms.maxDepth());
+}
+
+INSTANTIATE_TEST_CASE_P(MemSolverPlanners, MemSolverPlannerTest,
+                        ::testing::Values(Planner::Greedy, Planner::BestFit, Planner::IntervalColoring,
+                                          Planner::Optimal, Planner::Auto),
+                        MemSolverPlannerTest::getTestCaseName);
+
+TEST(MemSolverTest, OptimalSolvesUnefficiency) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {6, 7, 3, n++},
+            {2, 5, 2, n++},
+            {5, 8, 2, n++},
+            {2, 3, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, Planner::Optimal);
+    EXPECT_EQ(ms.solve(), 5);
+}
+
+TEST(MemSolverTest, OptimalSolvesNoOverlapping) {
+    int n = 0;
+    std::vector<Box> boxes{
+            {4, 8, 1, n++},
+            {6, 7, 3, n++},
+            {2, 3, 3, n++},
+            {2, 4, 2, n++},
+    };
+
+    MKLDNNPlugin::MemorySolver ms(boxes, Planner::Optimal);
+    EXPECT_EQ(ms.solve(), 5);
+}
+
+// Footprint of the planners on random branchy topologies compared to the lower bound
+TEST(MemSolverTest, PlannersFootprint) {
+    const std::vector<std::pair<std::string, Planner>> planners{
+        {"Greedy", Planner::Greedy}, {"BestFit", Planner::BestFit},
+        {"IntervalColoring", Planner::IntervalColoring}, {"Auto", Planner::Auto}};
+    std::mt19937 gen(7);
+    std::map<std::string, int64_t> footprint;
+    int64_t lowerBound = 0;
+    for (int topology = 0; topology < 50; topology++) {
+        std::vector<Box> boxes;
+        const int num = 10 + topology * 4;
+        for (int i = 0; i < num; i++) {
+            int start = i;
+            int finish = start + std::uniform_int_distribution<int>(1, 8)(gen);
+            boxes.push_back({start, finish, std::uniform_int_distribution<int64_t>(1, 1 << 12)(gen), i});
+        }
+        for (const auto& planner : planners) {
+            MKLDNNPlugin::MemorySolver ms(boxes, planner.second);
+            footprint[planner.first] += ms.solve();
+            if (planner.second == Planner::Auto)
+                lowerBound += ms.maxDepth();
+        }
+    }
+    for (const auto& planner : planners) {
+        ASSERT_GE(footprint[planner.first], lowerBound) << planner.first;
+    }
+    ASSERT_LE(footprint["Auto"], footprint["Greedy"]);
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_transformer_tests.hpp"
+
+#include <atomic>
+#include <stdexcept>
+
+#include <vpu/compile_env.hpp>
+#include <vpu/middleend/hw/tiling_cache.hpp>
+
+namespace vpu {
+
+class HwTilingCacheTests : public GraphTransformerTest {
+protected:
+    void SetUp() override {
+        ASSERT_NO_FATAL_FAILURE(GraphTransformerTest::SetUp());
+        ASSERT_NO_FATAL_FAILURE(InitCompileEnv());
+    }
+
+    static HWTilingNS::ConvolutionOptions convolutionOptions(const std::string& name, int width) {
+        const DimValues inputDims{{Dim::W, width}, {Dim::H, 56}, {Dim::C, 64}, {Dim::N, 1}};
+        const DimValues outputDims{{Dim::W, width}, {Dim::H, 56}, {Dim::C, 128}, {Dim::N, 1}};
+
+        return HWTilingNS::ConvolutionOptions{name, inputDims, outputDims, outputDims, 3, 3, 1, 1, 1, 1, 1, false};
+    }
+};
+
+TEST_F(HwTilingCacheTests, ParallelForKeepsCompileEnvAndRethrows) {
+    const auto& env = CompileEnv::get();
+
+    std::atomic<int> sum(0);
+    CompileEnv::parallelFor(100, [&](int ind) {
+        ASSERT_EQ(&env, &CompileEnv::get());
+        sum += ind;
+    });
+    ASSERT_EQ(99 * 100 / 2, sum.load());
+
+    ASSERT_THROW(CompileEnv::parallelFor(10, [](int ind) {
+        if (ind == 5) {
+            throw std::runtime_error("error");
+        }
+    }), std::runtime_error);
+}
+
+TEST_F(HwTilingCacheTests, EqualStagesShareTiling) {
+    const auto before = HWTilingNS::getTilingCacheStats();
+
+    const auto tiling1 = HWTilingNS::findConvTiling(convolutionOptions("conv1", 56),
+                                                    HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+    const auto tiling2 = HWTilingNS::findConvTiling(convolutionOptions("conv2", 56),
+                                                    HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+    const auto tiling3 = HWTilingNS::findConvTiling(convolutionOptions("conv3", 28),
+                                                    HWTilingNS::Direction::INPUT_TO_OUTPUT, 1);
+
+    const auto after = HWTilingNS::getTilingCacheStats();
+
+    ASSERT_TRUE(tiling1.tilingPossible);
+    ASSERT_EQ(tiling1.hwTilings, tiling2.hwTilings);
+    ASSERT_NE(tiling1.hwTilings, tiling3.hwTilings);
+
+    // the first and the third search may be cached by the previous runs of the test
+    ASSERT_GE(after.hits, before.hits + 1);
+    ASSERT_EQ(after.hits + after.misses, before.hits + before.misses + 3);
+}
+
+TEST_F(HwTilingCacheTests, PassSetReportsPassesTime) {
+    auto testModel = CreateTestModel();
+
+    const DataDesc desc{1};
+    testModel.createInputs({desc});
+    testModel.createOutputs({desc});
+    testModel.addStage({InputInfo::fromNetwork()}, {OutputInfo::fromNetwork()});
+
+    PassSet pipeline;
+    pipeline.addPass(passManager->initialCheck(), "initialCheck");
+    pipeline.addPass(passManager->markFastStages(), "markFastStages");
+    ASSERT_NO_THROW(pipeline.run(testModel.getBaseModel()));
+
+    const auto& passesTime = pipeline.passesTime();
+    ASSERT_EQ(2u, passesTime.size());
+    ASSERT_EQ("initialCheck", passesTime[0].first);
+    ASSERT_EQ("markFastStages", passesTime[1].first);
+    ASSERT_GE(passesTime[0].second, 0.0);
+}
+
+}  // namespace vpu
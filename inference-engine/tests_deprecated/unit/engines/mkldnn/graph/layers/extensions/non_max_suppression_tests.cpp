@@ -7,6 +7,8 @@
 #include "single_layer_common.hpp"
 #include "tests_common.hpp"
 #include <ie_core.hpp>
+#include <algorithm>
+#include <cmath>
 
 
 using namespace ::testing;
@@ -27,6 +29,7 @@ struct nmsTF_test_params {
     std::vector<int> ref;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+    std::vector<float> soft_nms_sigma;
 };
 
 static float intersectionOverUnion(float* boxesI, float* boxesJ, bool center_point_box) {
@@ -106,10 +109,47 @@ static void ref_nms(
     int num_classes = static_cast<int>(scores_dims[1]);
     std::vector<filteredBoxes> fb;
 
+    float soft_nms_sigma = 0.f;
+    if (p.soft_nms_sigma.size())
+        soft_nms_sigma = p.soft_nms_sigma[0];
+
     for (int batch = 0; batch < num_batches; batch++) {
         float *boxesPtr = boxes + batch * boxesStrides[0];
         for (int class_idx = 0; class_idx < num_classes; class_idx++) {
             float *scoresPtr = scores + batch * scoresStrides[0] + class_idx * scoresStrides[1];
+            if (soft_nms_sigma > 0.f) {
+                //  Soft-NMS: every selected box decays the scores of the remaining ones by exp(-0.5 * iou^2 / sigma),
+                //  boxes overlapping by iou_threshold or more are suppressed
+                std::vector<std::pair<float, int> > candidates;
+                for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
+                    if (scoresPtr[box_idx] > score_threshold)
+                        candidates.push_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                }
+                int io_selection_size = 0;
+                while (candidates.size() && io_selection_size < max_output_boxes_per_class) {
+                    auto best = std::min_element(candidates.begin(), candidates.end(),
+                            [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                                return l.first > r.first || (l.first == r.first && l.second < r.second); });
+                    const auto selected = *best;
+                    candidates.erase(best);
+                    io_selection_size++;
+                    fb.push_back({ selected.first, batch, class_idx, selected.second });
+
+                    std::vector<std::pair<float, int> > remaining;
+                    for (auto candidate : candidates) {
+                        float iou = intersectionOverUnion(&boxesPtr[candidate.second * 4],
+                                                          &boxesPtr[selected.second * 4], (p.center_point_box == 1));
+                        if (iou >= iou_threshold)
+                            continue;
+                        candidate.first *= std::exp(-0.5f * iou * iou / soft_nms_sigma);
+                        if (candidate.first > score_threshold)
+                            remaining.push_back(candidate);
+                    }
+                    candidates.swap(remaining);
+                }
+                continue;
+            }
+
             std::vector<std::pair<float, int> > scores_vector;
             for (int box_idx = 0; box_idx < num_boxes; box_idx++) {
                 if (scoresPtr[box_idx] > score_threshold)
@@ -366,6 +406,75 @@ class MKLDNNCPUExtNonMaxSuppressionTFTests : public TestsCommon, public WithPara
         <edge from-layer="5" from-port="5" to-layer="6" to-port="5"/>
     </edges>
 </net>
+)V0G0N";
+
+    std::string model_t6 = R"V0G0N(
+<net Name="NonMaxSuppression_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="InputBoxes" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    _IBOXES_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputScores" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    _ISCORES_
+                </port>
+            </output>
+        </layer>
+        <layer name="InputBoxesPerClass" type="Input" precision="I32" id="3">
+            <output>
+                <port id="3"/>
+            </output>
+        </layer>
+        <layer name="InputIouThr" type="Input" precision="FP32" id="4">
+            <output>
+                <port id="4"/>
+            </output>
+        </layer>
+        <layer name="InputScoreThr" type="Input" precision="FP32" id="5">
+            <output>
+                <port id="5"/>
+            </output>
+        </layer>
+        <layer name="InputSoftNmsSigma" type="Input" precision="FP32" id="7">
+            <output>
+                <port id="7"/>
+            </output>
+        </layer>
+        <layer name="non_max_suppression" type="NonMaxSuppression" precision="FP32" id="6">
+            <data center_point_box="_CPB_" sort_result_descending="_SRD_"/>
+            <input>
+                <port id="1">
+                    _IBOXES_
+                </port>
+                <port id="2">
+                    _ISCORES_
+                </port>
+                <port id="3" precision="I32"/>
+                <port id="4"/>
+                <port id="5"/>
+                <port id="7"/>
+            </input>
+            <output>
+                <port id="6" precision="I32">
+                    _IOUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="6" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="6" to-port="2"/>
+        <edge from-layer="3" from-port="3" to-layer="6" to-port="3"/>
+        <edge from-layer="4" from-port="4" to-layer="6" to-port="4"/>
+        <edge from-layer="5" from-port="5" to-layer="6" to-port="5"/>
+        <edge from-layer="7" from-port="7" to-layer="6" to-port="7"/>
+    </edges>
+</net>
 )V0G0N";
 
     std::string getModel(nmsTF_test_params p) {
@@ -376,8 +485,10 @@ class MKLDNNCPUExtNonMaxSuppressionTFTests : public TestsCommon, public WithPara
             model = model_t3;
         else if (!p.score_threshold.size())
             model = model_t4;
-        else
+        else if (!p.soft_nms_sigma.size())
             model = model_t5;
+        else
+            model = model_t6;
 
         std::string inBoxes;
         std::string inScores;
@@ -485,6 +596,15 @@ protected:
                 srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputScoreThr", srcScoreThr));
             }
 
+            // Input SoftNmsSigma
+            InferenceEngine::Blob::Ptr srcSoftNmsSigma;
+            if (p.soft_nms_sigma.size()) {
+                srcSoftNmsSigma = InferenceEngine::make_shared_blob<float>({ InferenceEngine::Precision::FP32, {}, InferenceEngine::TensorDesc::getLayoutByDims({}) });
+                srcSoftNmsSigma->allocate();
+                memcpy(static_cast<float*>(srcSoftNmsSigma->buffer()), &p.soft_nms_sigma[0], sizeof(float));
+                srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("InputSoftNmsSigma", srcSoftNmsSigma));
+            }
+
             //  Output Data
             InferenceEngine::OutputsDataMap out;
             out = network.getOutputsInfo();
@@ -564,5 +684,18 @@ INSTANTIATE_TEST_CASE_P(
 
             nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, {}, {}, 3, { 0,0,3,0,0,0,0,0,1 } }, /*nonmaxsuppression_no_iou_threshold_and_score_threshold*/
 
-            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} } /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, {}, {}, {}, 3, {} }, /*nonmaxsuppression_no_max_output_boxes_per_class_and_iou_threshold_and_score_threshold*/
+
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 6 }, { 1.0 }, { 0.0 }, 6, { 0,0,3,0,0,0,0,0,1,0,0,5,0,0,4,0,0,2 }, {}, { 0.5 } }, /*nonmaxsuppression_soft_nms_decay*/
+
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 6 }, { 1.0 }, { 0.5 }, 3, { 0,0,3,0,0,0,-1,-1,-1 }, {}, { 0.5 } }, /*nonmaxsuppression_soft_nms_decay_below_score_threshold*/
+
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 6 }, { 0.9 }, { 0.0 }, 6, { 0,0,3,0,0,0,0,0,5,0,0,1,0,0,4,0,0,2 }, {}, { 0.1 } }, /*nonmaxsuppression_soft_nms_reordered_by_decay*/
+
+            nmsTF_test_params{ 0, 1, { 1,1,6 }, boxes, scores, { 3 }, { 0.5 }, { 0.0 }, 3, reference, {}, { 0.5 } }, /*nonmaxsuppression_soft_nms_suppress_by_IOU*/
+
+            nmsTF_test_params{ 0, 0, { 2,2,6 },{ 0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0, -0.1, 1.0, 0.9, 0.0, 10.0, 1.0, 11.0, 0.0, 10.1, 1.0, 11.1, 0.0, 100.0, 1.0, 101.0,
+                                             0.0, 0.0, 1.0, 1.0, 0.0, 0.1, 1.0, 1.1, 0.0, -0.1, 1.0, 0.9, 0.0, 10.0, 1.0, 11.0, 0.0, 10.1, 1.0, 11.1, 0.0, 100.0, 1.0, 101.0 },
+            { 0.9, 0.75, 0.6, 0.95, 0.5, 0.3, 0.3, 0.5, 0.95, 0.6, 0.75, 0.9, 0.9, 0.75, 0.6, 0.95, 0.5, 0.3, 0.3, 0.5, 0.95, 0.6, 0.75, 0.9 },
+            { 4 },{ 0.95 },{ 0.05 }, 16, {}, {}, { 0.25 } } /*nonmaxsuppression_soft_nms_two_batches_two_classes*/
 ));
@@ -7,10 +7,12 @@
 #include <fstream>
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <unordered_map>
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
 
 #include <gflags/gflags.h>
 
@@ -54,6 +56,8 @@ static constexpr char inputs_layout_message[] = "Optional. Specifies layout for
 static constexpr char outputs_layout_message[] = "Optional. Specifies layout for all input layers of the network."
                                                  " Supported values: NCHW, NHWC, NC, C.";
 
+static constexpr char report_compile_time_message[] = "Optional. Print the duration of every graph transformer pass.";
+
 static constexpr char dla_arch_name[] = "Optional. Specify architecture name used to compile executable network for FPGA device.";
 
 DEFINE_bool(h, false, help_message);
@@ -69,6 +73,7 @@ DEFINE_string(ol, "", outputs_layout_message);
 DEFINE_string(VPU_NUMBER_OF_SHAVES, "", number_of_shaves_message);
 DEFINE_string(VPU_NUMBER_OF_CMX_SLICES, "", number_of_cmx_slices_message);
 DEFINE_string(VPU_TILING_CMX_LIMIT_KB, "", tiling_cmx_limit_message);
+DEFINE_bool(report_compile_time, false, report_compile_time_message);
 DEFINE_string(DLA_ARCH_NAME, "", dla_arch_name);
 
 static void showUsage() {
@@ -90,6 +95,7 @@ static void showUsage() {
     std::cout << "      -VPU_NUMBER_OF_SHAVES      <value>     "   << number_of_shaves_message     << std::endl;
     std::cout << "      -VPU_NUMBER_OF_CMX_SLICES  <value>     "   << number_of_cmx_slices_message << std::endl;
     std::cout << "      -VPU_TILING_CMX_LIMIT_KB   <value>     "   << tiling_cmx_limit_message     << std::endl;
+    std::cout << "      -report_compile_time                   "   << report_compile_time_message  << std::endl;
     std::cout << "    DLA options:                             "                                   << std::endl;
     std::cout << "      -DLA_ARCH_NAME             <value>     "   << dla_arch_name                << std::endl;
     std::cout << std::endl;
@@ -396,6 +402,55 @@ std::string getFileNameFromPath(const std::string& path,
 
 using TimeDiff = std::chrono::milliseconds;
 
+static void reportCompileTime(const InferenceEngine::ExecutableNetwork& executableNetwork) {
+    using PassesTime = std::vector<std::pair<std::string, double>>;
+
+    PassesTime passesTime;
+    try {
+        passesTime = executableNetwork.GetMetric(InferenceEngine::MYRIAD_PASSES_TIME).as<PassesTime>();
+    } catch (const InferenceEngine::details::InferenceEngineException&) {
+        std::cout << "Compile time report is not supported by the " << FLAGS_d << " device" << std::endl;
+        return;
+    }
+
+    // Some passes (e.g. dumpModel) run several times, so they are also summed up by name
+    std::map<std::string, std::pair<double, int>> passesTotal;
+    double total = 0.0;
+
+    const auto coutFlags = std::cout.flags();
+    const auto coutPrecision = std::cout.precision();
+
+    std::cout << "Compile time report:" << std::endl;
+    for (size_t ind = 0; ind < passesTime.size(); ++ind) {
+        const auto& pass = passesTime[ind];
+        std::cout << "  " << std::setw(3) << ind + 1 << "  " << std::left << std::setw(48) << pass.first << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(10) << pass.second << " ms" << std::endl;
+
+        auto& passTotal = passesTotal[pass.first];
+        passTotal.first += pass.second;
+        passTotal.second++;
+        total += pass.second;
+    }
+
+    std::vector<std::pair<std::string, std::pair<double, int>>> slowest(passesTotal.begin(), passesTotal.end());
+    std::sort(slowest.begin(), slowest.end(), [](const std::pair<std::string, std::pair<double, int>>& lhs,
+                                                 const std::pair<std::string, std::pair<double, int>>& rhs) {
+        return lhs.second.first > rhs.second.first;
+    });
+
+    std::cout << "Slowest passes:" << std::endl;
+    for (size_t ind = 0; ind < std::min<size_t>(slowest.size(), 10); ++ind) {
+        const auto& pass = slowest[ind];
+        std::cout << "  " << std::left << std::setw(53) << pass.first << std::right
+                  << std::fixed << std::setprecision(3) << std::setw(10) << pass.second.first << " ms"
+                  << " (" << pass.second.second << " run(s), "
+                  << std::setprecision(1) << (total > 0.0 ? 100.0 * pass.second.first / total : 0.0) << "%)" << std::endl;
+    }
+    std::cout << "Total passes time: " << std::setprecision(3) << total << " ms" << std::endl;
+    std::cout.flags(coutFlags);
+    std::cout.precision(coutPrecision);
+}
+
 int main(int argc, char *argv[]) {
     TimeDiff loadNetworkTimeElapsed {0};
     try {
@@ -417,6 +472,10 @@ int main(int argc, char *argv[]) {
         auto executableNetwork = ie.LoadNetwork(network, FLAGS_d, configure(FLAGS_c, FLAGS_m));
         loadNetworkTimeElapsed = std::chrono::duration_cast<TimeDiff>(std::chrono::steady_clock::now() - timeBeforeLoadNetwork);
 
+        if (FLAGS_report_compile_time) {
+            reportCompileTime(executableNetwork);
+        }
+
         std::string outputName = FLAGS_o;
         if (outputName.empty()) {
             outputName = getFileNameFromPath(fileNameNoExt(FLAGS_m)) + ".blob";
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -149,6 +150,13 @@ namespace ngraph
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
 
+        // the last topological order, valid while Node::get_graph_version() is not changed. The
+        // version is global and the changed region is not tracked, so any change of any graph
+        // makes the whole order be sorted again.
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<std::weak_ptr<Node>> m_ordered_ops_cache;
+        mutable size_t m_ordered_ops_version{0};
+
         ResultVector m_results;
         ParameterVector m_parameters;
     };
@@ -288,6 +288,15 @@ namespace ngraph
         /// This node's control dependencies are replaced by replacement
         void transfer_control_dependents(std::shared_ptr<Node> replacement);
 
+        /// \brief Returns a counter which is incremented whenever inputs or control dependencies
+        /// of any node are changed. Function uses it to reuse its topological order while graphs
+        /// stay unchanged.
+        static size_t get_graph_version();
+
+        /// \brief Increments the counter returned by get_graph_version(). Node and Input methods
+        /// call it, so it is needed only for code which rewires nodes in some other way.
+        static void graph_changed();
+
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
 
@@ -475,6 +484,7 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> m_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
         std::deque<descriptor::Input> m_inputs;
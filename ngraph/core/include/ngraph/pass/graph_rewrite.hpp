@@ -146,8 +146,15 @@ public:
 
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
+    /// \brief Returns the number of matcher pass applications during the last run
+    size_t get_applied_count() const { return m_applied_count; }
+    /// \brief Returns the number of successful matcher pass applications during the last run
+    size_t get_matched_count() const { return m_matched_count; }
+
 protected:
     bool m_enable_shape_inference = false;
+    size_t m_applied_count = 0;
+    size_t m_matched_count = 0;
 
     std::vector<std::shared_ptr<ngraph::pass::MatcherPass>> m_matchers;
 };
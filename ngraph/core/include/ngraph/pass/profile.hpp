@@ -0,0 +1,47 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        namespace profile
+        {
+            /// \brief Returns true if NGRAPH_PROFILE_PASS_ENABLE environment variable is set
+            NGRAPH_API
+            bool is_enabled();
+
+            /// \brief Statistics of Function::get_ordered_ops calls. The calls and the cache hits
+            /// are always counted, the time is measured only if profiling is enabled.
+            struct OrderedOpsCounters
+            {
+                std::atomic<size_t> calls{0};
+                std::atomic<size_t> cache_hits{0};
+                std::atomic<size_t> microseconds{0};
+            };
+
+            NGRAPH_API
+            OrderedOpsCounters& get_ordered_ops_counters();
+        }
+    }
+}
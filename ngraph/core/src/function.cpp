@@ -24,6 +24,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/op_types.hpp"
+#include "ngraph/pass/profile.hpp"
 #include "ngraph/util.hpp"
 #include "ngraph/validation_util.hpp"
 
@@ -101,17 +102,63 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
-    vector<shared_ptr<Node>> nodes;
-    for (auto& r : get_results())
+    stopwatch timer;
+    if (pass::profile::is_enabled())
     {
-        nodes.push_back(r);
+        timer.start();
     }
-    for (auto& param : get_parameters())
+
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    // the version is read before sorting, so changes made by other threads during sorting are
+    // not missed by the next call
+    auto version = Node::get_graph_version();
+    vector<shared_ptr<Node>> ordered_ops;
+    bool cache_hit = false;
+    if (version == m_ordered_ops_version && !m_ordered_ops_cache.empty())
     {
-        nodes.push_back(param);
+        ordered_ops.reserve(m_ordered_ops_cache.size());
+        cache_hit = true;
+        for (auto& cached_node : m_ordered_ops_cache)
+        {
+            auto node = cached_node.lock();
+            if (!node)
+            {
+                cache_hit = false;
+                ordered_ops.clear();
+                break;
+            }
+            ordered_ops.push_back(node);
+        }
     }
 
-    return m_topological_sorter(nodes);
+    if (!cache_hit)
+    {
+        vector<shared_ptr<Node>> nodes;
+        for (auto& r : get_results())
+        {
+            nodes.push_back(r);
+        }
+        for (auto& param : get_parameters())
+        {
+            nodes.push_back(param);
+        }
+
+        ordered_ops = m_topological_sorter(nodes);
+        // weak pointers do not keep removed nodes alive, as they are still consumers of their
+        // inputs for the passes
+        m_ordered_ops_cache.assign(ordered_ops.begin(), ordered_ops.end());
+        m_ordered_ops_version = version;
+    }
+
+    auto& counters = pass::profile::get_ordered_ops_counters();
+    counters.calls++;
+    counters.cache_hits += cache_hit ? 1 : 0;
+    if (pass::profile::is_enabled())
+    {
+        timer.stop();
+        counters.microseconds += timer.get_microseconds();
+    }
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -270,11 +317,14 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    Node::graph_changed();
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
     m_topological_sorter = sorter;
+    m_ordered_ops_cache.clear();
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -344,6 +394,7 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("parameters", m_parameters);
     visitor.on_attribute("results", m_results);
+    Node::graph_changed();
     return true;
 }
 
@@ -32,6 +32,7 @@ using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_version(0);
 
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
@@ -169,6 +170,7 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    graph_changed();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -470,6 +472,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        graph_changed();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -507,6 +510,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            graph_changed();
             m_control_dependencies.erase(it);
         }
     }
@@ -529,7 +533,11 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
-    m_control_dependencies.clear();
+    if (!m_control_dependencies.empty())
+    {
+        graph_changed();
+        m_control_dependencies.clear();
+    }
 }
 
 void Node::clear_control_dependents()
@@ -540,6 +548,16 @@ void Node::clear_control_dependents()
     }
 }
 
+size_t Node::get_graph_version()
+{
+    return m_graph_version;
+}
+
+void Node::graph_changed()
+{
+    ++m_graph_version;
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
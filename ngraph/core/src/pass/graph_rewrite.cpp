@@ -71,6 +71,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
 
     bool rewritten = false;
+    m_applied_count = 0;
+    m_matched_count = 0;
 
     // Initialize execution queue with nodes in topological order
     deque<std::shared_ptr<Node>> nodes_to_run;
@@ -146,6 +148,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        m_applied_count++;
+        m_matched_count += status ? 1 : 0;
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
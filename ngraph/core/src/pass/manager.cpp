@@ -28,6 +28,7 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/profile.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/util.hpp"
 
@@ -47,7 +48,8 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::Manager::run_passes");
 
-    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    bool profile_enabled = pass::profile::is_enabled();
+    auto& ordered_ops_counters = pass::profile::get_ordered_ops_counters();
 
     size_t index = 0;
     stopwatch pass_timer;
@@ -57,6 +59,13 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     for (auto& pass : m_pass_list)
     {
         pass_timer.start();
+        size_t ordered_ops_calls = ordered_ops_counters.calls;
+        size_t ordered_ops_cache_hits = ordered_ops_counters.cache_hits;
+        size_t ordered_ops_microseconds = ordered_ops_counters.microseconds;
+        const GraphRewrite* graph_rewrite = nullptr;
+        // GraphRewrite is a temporary container for MatcherPass to make execution
+        // on on entire ngraph::Function
+        std::unique_ptr<GraphRewrite> matcher_pass_rewrite;
         if (!m_has_default_callback)
         {
             pass->set_callback(m_transformation_callback);
@@ -74,9 +83,9 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
                              << "function is dynamic. Skipping this transformation";
                 continue;
             }
-            // GraphRewrite is a temporary container for MatcherPass to make execution
-            // on on entire ngraph::Function
-            function_changed = GraphRewrite(matcher_pass).run_on_function(func);
+            matcher_pass_rewrite.reset(new GraphRewrite(matcher_pass));
+            function_changed = matcher_pass_rewrite->run_on_function(func);
+            graph_rewrite = matcher_pass_rewrite.get();
         }
         else if (auto function_pass = dynamic_pointer_cast<FunctionPass>(pass))
         {
@@ -101,6 +110,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
             else
             {
                 function_changed = function_pass->run_on_function(func);
+                graph_rewrite = dynamic_cast<const GraphRewrite*>(function_pass.get());
             }
         }
         else if (auto node_pass = dynamic_pointer_cast<NodePass>(pass))
@@ -139,7 +149,17 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
         pass_timer.stop();
         if (profile_enabled)
         {
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name();
+            if (graph_rewrite)
+            {
+                cout << " matched " << graph_rewrite->get_matched_count() << " of "
+                     << graph_rewrite->get_applied_count();
+            }
+            cout << ", get_ordered_ops " << ordered_ops_counters.calls - ordered_ops_calls
+                 << " calls (" << ordered_ops_counters.cache_hits - ordered_ops_cache_hits
+                 << " cached) in "
+                 << (ordered_ops_counters.microseconds - ordered_ops_microseconds) / 1000.0
+                 << "ms\n";
         }
     }
     if (profile_enabled)
@@ -0,0 +1,32 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/profile.hpp"
+#include "ngraph/env_util.hpp"
+
+using namespace ngraph;
+
+bool pass::profile::is_enabled()
+{
+    static const bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    return profile_enabled;
+}
+
+pass::profile::OrderedOpsCounters& pass::profile::get_ordered_ops_counters()
+{
+    static OrderedOpsCounters counters;
+    return counters;
+}
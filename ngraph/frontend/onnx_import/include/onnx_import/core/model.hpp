@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -32,6 +33,11 @@ namespace ngraph
         public:
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \brief Constructs the model which shares the ownership of the model message,
+            ///        so the raw data of the initializers are not copied to the constants.
+            /// \param model_dir The directory the external data of the tensors are read from.
+            Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto,
+                  const std::string& model_dir);
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -42,6 +48,11 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            const std::string& get_model_dir() const { return m_model_dir; }
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_model_proto() const
+            {
+                return m_model_proto_owner;
+            }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -74,6 +85,8 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto_owner;
+            std::string m_model_dir;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
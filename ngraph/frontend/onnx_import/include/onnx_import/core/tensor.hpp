@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <onnx/onnx_pb.h>
 #include <utility>
 #include <vector>
@@ -23,6 +25,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -403,9 +406,17 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor       The tensor message.
+            /// \param model_dir    The directory the external data locations are relative to.
+            /// \param model_proto  The model which owns the tensor message. If it is given the
+            ///                     raw data of the tensor are shared with the constants.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            const std::string& model_dir = {},
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_model_dir{model_dir}
+                , m_model_proto{std::move(model_proto)}
             {
                 if (m_shape == Shape{0})
                 {
@@ -430,6 +441,14 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    const auto buffer =
+                        detail::TensorExternalData{*m_tensor_proto}.load(m_model_dir);
+                    std::vector<T> data(buffer->size() / sizeof(T));
+                    std::memcpy(data.data(), buffer->get_ptr(), data.size() * sizeof(T));
+                    return data;
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -523,11 +542,52 @@ namespace ngraph
             }
 
         private:
+            /// \brief Returns the buffer which refers to the data of the tensor without copying
+            ///        or nullptr if the data have to be converted.
+            std::shared_ptr<detail::TensorBuffer> get_buffer(const element::Type& type) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    throw error::tensor::segments_unsupported{};
+                }
+                std::shared_ptr<detail::TensorBuffer> buffer;
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    buffer = detail::TensorExternalData{*m_tensor_proto}.load(m_model_dir);
+                }
+                else if (m_tensor_proto->has_raw_data() && m_model_proto)
+                {
+                    const auto& raw_data = m_tensor_proto->raw_data();
+                    buffer = std::make_shared<detail::TensorBuffer>(
+                        const_cast<char*>(raw_data.data()), raw_data.size(), m_model_proto);
+                }
+                if (!buffer || buffer->size() != shape_size(m_shape) * type.size())
+                {
+                    return nullptr;
+                }
+                // unaligned elements are copied to the aligned memory
+                if (reinterpret_cast<std::uintptr_t>(buffer->get_ptr()) % type.size() != 0)
+                {
+                    auto storage = std::make_shared<runtime::AlignedBuffer>(buffer->size());
+                    std::memcpy(storage->get_ptr(), buffer->get_ptr(), buffer->size());
+                    buffer = std::make_shared<detail::TensorBuffer>(
+                        storage->get_ptr<char>(), storage->size(), storage);
+                }
+                return buffer;
+            }
+
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (auto buffer = get_buffer(type))
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -537,6 +597,8 @@ namespace ngraph
 
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::string m_model_dir;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -68,6 +68,21 @@ namespace ngraph
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(std::istream& stream);
 
+        /// \brief      Imports and converts an serialized ONNX model from the input stream
+        ///             to an nGraph Function representation.
+        ///
+        /// \note       The raw data of the initializers are not copied, the data stored in
+        ///             the external files are mapped into memory.
+        ///
+        /// \param[in]  stream      The input stream (e.g. file stream, memory stream, etc).
+        /// \param[in]  model_path  The path of the model, the locations of the external data
+        ///                         are relative to its directory.
+        ///
+        /// \return     An nGraph function that represents a single output from the created graph.
+        ONNX_IMPORTER_API
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path);
+
         /// \brief     Imports and converts an ONNX model from the input file
         ///            to an nGraph Function representation.
         ///
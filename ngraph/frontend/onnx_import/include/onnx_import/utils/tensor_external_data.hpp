@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "onnx_import/utils/onnx_importer_visibility.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& what)
+                        : ngraph_error{"invalid external data: " + what}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            /// \brief Buffer which refers to the memory of a tensor without copying it. The
+            ///        owner object keeps the memory valid (e.g. the model or a mapped file).
+            using TensorBuffer = runtime::SharedBuffer<std::shared_ptr<const void>>;
+
+            /// \brief Data of a tensor stored outside of the model file, described by the
+            ///        "location", "offset" and "length" entries of the external_data field.
+            class ONNX_IMPORTER_API TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief      Maps the data of the tensor into memory. The file is read
+                ///             only if it can not be mapped.
+                ///
+                /// \param[in]  model_dir  The directory the location is relative to.
+                ///
+                /// \return     The buffer which keeps the mapping alive.
+                std::shared_ptr<TensorBuffer> load(const std::string& model_dir) const;
+
+                std::string to_string() const;
+
+            private:
+                std::string m_data_location;
+                std::uint64_t m_offset = 0;
+                std::uint64_t m_data_length = 0;
+            };
+
+            inline bool has_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() ==
+                           ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
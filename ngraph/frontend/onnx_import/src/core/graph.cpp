@@ -27,6 +27,7 @@
 #include "onnx_import/exceptions.hpp"
 #include "onnx_import/utils/common.hpp"
 #include "onnx_import/utils/provenance_tag.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -86,13 +87,19 @@ namespace ngraph
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
+                    Tensor tensor = Tensor{
+                        initializer_tensor, m_model->get_model_dir(), m_model->get_model_proto()};
                     std::shared_ptr<default_opset::Constant> ng_constant;
                     // For each initializer create a Constant node and store it in cache
                     try
                     {
                         ng_constant = tensor.get_ng_constant();
                     }
+                    catch (const error::tensor::invalid_external_data&)
+                    {
+                        // the data file is missing or damaged, the model can not be imported
+                        throw;
+                    }
                     catch (const ngraph::ngraph_error& exc)
                     {
                         NGRAPH_WARN << "Could not create an nGraph Constant for initializer '"
@@ -45,6 +45,14 @@ namespace ngraph
             }
         }
 
+        Model::Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto,
+                     const std::string& model_dir)
+            : Model(*model_proto)
+        {
+            m_model_proto_owner = std::move(model_proto);
+            m_model_dir = model_dir;
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
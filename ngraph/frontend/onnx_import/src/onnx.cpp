@@ -73,11 +73,17 @@ namespace ngraph
 
             } // namespace error
 
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            std::shared_ptr<Function> convert_to_ng_function(
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto,
+                const std::string& model_path)
             {
-                Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                // The locations of the external data are relative to the model directory
+                const auto separator = model_path.find_last_of("/\\");
+                const auto model_dir = separator == std::string::npos
+                                           ? std::string{}
+                                           : model_path.substr(0, separator + 1);
+                Model model{model_proto, model_dir};
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -90,6 +96,12 @@ namespace ngraph
         } // namespace detail
 
         std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return import_onnx_model(stream, {});
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                    const std::string& model_path)
         {
             if (!stream.good())
             {
@@ -101,9 +113,10 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            // The model outlives the import, constants refer to the raw data of its tensors
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            if (!model_proto->ParseFromIstream(&stream))
             {
 #ifdef NGRAPH_USE_PROTOBUF_LITE
                 throw detail::error::stream_parse_binary();
@@ -113,13 +126,13 @@ namespace ngraph
                 stream.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&stream);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse_text();
                 }
 #endif
             }
-            return detail::convert_to_ng_function(model_proto);
+            return detail::convert_to_ng_function(model_proto, model_path);
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
@@ -129,7 +142,7 @@ namespace ngraph
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            return import_onnx_model(ifs, file_path);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
@@ -0,0 +1,259 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            namespace
+            {
+                /// \brief Read only private mapping of a part of a file
+                class MappedRegion
+                {
+                public:
+                    MappedRegion(const std::string& path,
+                                 std::uint64_t offset,
+                                 std::uint64_t length)
+                    {
+#ifdef _WIN32
+                        SYSTEM_INFO info;
+                        GetSystemInfo(&info);
+                        const std::uint64_t aligned_offset =
+                            offset - offset % info.dwAllocationGranularity;
+                        m_file = CreateFileA(path.c_str(),
+                                             GENERIC_READ,
+                                             FILE_SHARE_READ,
+                                             nullptr,
+                                             OPEN_EXISTING,
+                                             FILE_ATTRIBUTE_NORMAL,
+                                             nullptr);
+                        if (m_file == INVALID_HANDLE_VALUE)
+                        {
+                            return;
+                        }
+                        m_mapping =
+                            CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                        if (m_mapping == nullptr)
+                        {
+                            return;
+                        }
+                        m_size = static_cast<size_t>(length + offset - aligned_offset);
+                        m_address = MapViewOfFile(m_mapping,
+                                                  FILE_MAP_READ,
+                                                  static_cast<DWORD>(aligned_offset >> 32),
+                                                  static_cast<DWORD>(aligned_offset & 0xFFFFFFFF),
+                                                  m_size);
+                        if (m_address != nullptr)
+                        {
+                            m_data = static_cast<char*>(m_address) + (offset - aligned_offset);
+                        }
+#else
+                        const std::uint64_t page_size = sysconf(_SC_PAGESIZE);
+                        const std::uint64_t aligned_offset = offset - offset % page_size;
+                        const int fd = open(path.c_str(), O_RDONLY);
+                        if (fd == -1)
+                        {
+                            return;
+                        }
+                        m_size = static_cast<size_t>(length + offset - aligned_offset);
+                        void* address = mmap(nullptr,
+                                             m_size,
+                                             PROT_READ,
+                                             MAP_PRIVATE,
+                                             fd,
+                                             static_cast<off_t>(aligned_offset));
+                        // the mapping stays valid after the descriptor is closed
+                        close(fd);
+                        if (address != MAP_FAILED)
+                        {
+                            m_address = address;
+                            m_data = static_cast<char*>(m_address) + (offset - aligned_offset);
+                        }
+#endif
+                    }
+
+                    MappedRegion(const MappedRegion&) = delete;
+                    MappedRegion& operator=(const MappedRegion&) = delete;
+
+                    ~MappedRegion()
+                    {
+#ifdef _WIN32
+                        if (m_address != nullptr)
+                        {
+                            UnmapViewOfFile(m_address);
+                        }
+                        if (m_mapping != nullptr)
+                        {
+                            CloseHandle(m_mapping);
+                        }
+                        if (m_file != INVALID_HANDLE_VALUE)
+                        {
+                            CloseHandle(m_file);
+                        }
+#else
+                        if (m_address != nullptr)
+                        {
+                            munmap(m_address, m_size);
+                        }
+#endif
+                    }
+
+                    char* data() const { return m_data; }
+                private:
+#ifdef _WIN32
+                    HANDLE m_file = INVALID_HANDLE_VALUE;
+                    HANDLE m_mapping = nullptr;
+#endif
+                    void* m_address = nullptr;
+                    size_t m_size = 0;
+                    char* m_data = nullptr;
+                };
+
+                /// \brief Checks that the location stays inside of the model directory: it is
+                ///        neither absolute nor refers to a parent directory
+                bool is_relative_to_model_dir(const std::string& location)
+                {
+                    if (location.front() == '/' || location.front() == '\\' ||
+                        (location.size() > 1 && location[1] == ':'))
+                    {
+                        return false;
+                    }
+                    size_t begin = 0;
+                    while (begin <= location.size())
+                    {
+                        const auto end = std::min(location.find_first_of("/\\", begin),
+                                                  location.size());
+                        if (location.compare(begin, end - begin, "..") == 0)
+                        {
+                            return false;
+                        }
+                        begin = end + 1;
+                    }
+                    return true;
+                }
+            }
+
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        m_data_location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        m_offset = std::stoull(entry.value());
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        m_data_length = std::stoull(entry.value());
+                    }
+                }
+                if (m_data_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"location of tensor '" +
+                                                               tensor.name() +
+                                                               "' is not specified"};
+                }
+                if (!is_relative_to_model_dir(m_data_location))
+                {
+                    throw error::tensor::invalid_external_data{
+                        "location of tensor '" + tensor.name() +
+                        "' must be relative to the model directory: " + m_data_location};
+                }
+            }
+
+            std::shared_ptr<TensorBuffer>
+                TensorExternalData::load(const std::string& model_dir) const
+            {
+                const auto path = model_dir.empty()
+                                      ? m_data_location
+                                      : file_util::path_join(model_dir, m_data_location);
+                std::ifstream file{path, std::ios::in | std::ios::binary | std::ios::ate};
+                if (!file.is_open())
+                {
+                    throw error::tensor::invalid_external_data{"can not open " + to_string()};
+                }
+                const std::uint64_t file_size = static_cast<std::uint64_t>(file.tellg());
+                // the length is optional, the data lasts till the end of the file then
+                const std::uint64_t length =
+                    m_data_length == 0 && m_offset <= file_size ? file_size - m_offset
+                                                                : m_data_length;
+                if (m_offset > file_size || length > file_size - m_offset)
+                {
+                    throw error::tensor::invalid_external_data{
+                        "the file is too short, size: " + std::to_string(file_size) + ", " +
+                        to_string()};
+                }
+                if (length == 0)
+                {
+                    auto storage = std::make_shared<runtime::AlignedBuffer>(0);
+                    return std::make_shared<TensorBuffer>(storage->get_ptr<char>(), 0, storage);
+                }
+
+                auto region = std::make_shared<MappedRegion>(path, m_offset, length);
+                if (region->data() != nullptr)
+                {
+                    return std::make_shared<TensorBuffer>(region->data(), length, region);
+                }
+
+                NGRAPH_WARN << "Could not map " << to_string() << ", the data is read";
+                auto storage = std::make_shared<runtime::AlignedBuffer>(length);
+                file.seekg(static_cast<std::streamoff>(m_offset));
+                file.read(storage->get_ptr<char>(), static_cast<std::streamsize>(length));
+                if (!file)
+                {
+                    throw error::tensor::invalid_external_data{"can not read " + to_string()};
+                }
+                return std::make_shared<TensorBuffer>(storage->get_ptr<char>(), length, storage);
+            }
+
+            std::string TensorExternalData::to_string() const
+            {
+                std::stringstream s;
+                s << "ExternalDataInfo(";
+                s << "data_full_path: " << m_data_location;
+                s << ", offset: " << m_offset;
+                s << ", data_length: " << m_data_length;
+                s << ")";
+                return s.str();
+            }
+
+        } // namespace detail
+    }     // namespace onnx_import
+} // namespace ngraph
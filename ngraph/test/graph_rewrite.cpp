@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/profile.hpp>
 #include <util/test_tools.hpp>
 
 using namespace ::testing;
@@ -244,4 +245,50 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     anchor.run_on_function(f);
 
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
-}
\ No newline at end of file
+}
+
+TEST(GraphRewriteTest, MatchCounts)
+{
+    auto f = get_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+    ASSERT_EQ(anchor.get_matched_count(), 1);
+    ASSERT_EQ(anchor.get_applied_count(), 4);
+
+    anchor.run_on_function(f);
+    ASSERT_EQ(anchor.get_matched_count(), 0);
+}
+
+TEST(GraphRewriteTest, OrderedOpsFollowGraphChanges)
+{
+    auto& counters = pass::profile::get_ordered_ops_counters();
+    auto f = get_function();
+
+    // the order sorted by the constructor is reused while the graph does not change
+    size_t calls = counters.calls, cache_hits = counters.cache_hits;
+    auto ordered_ops = f->get_ordered_ops();
+    ASSERT_EQ(ordered_ops, f->get_ordered_ops());
+    ASSERT_EQ(counters.calls - calls, 2);
+    ASSERT_EQ(counters.cache_hits - cache_hits, 2);
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    // the replaced Divide must not be returned from the cached order, so it is sorted again
+    calls = counters.calls;
+    cache_hits = counters.cache_hits;
+    ordered_ops = f->get_ordered_ops();
+    ASSERT_EQ(counters.calls - calls, 1);
+    ASSERT_EQ(counters.cache_hits - cache_hits, 0);
+    ASSERT_EQ(ordered_ops, f->get_ordered_ops());
+    ASSERT_EQ(counters.cache_hits - cache_hits, 1);
+    ASSERT_EQ(ordered_ops.size(), 3);
+    ASSERT_EQ(count_ops_of_type<opset3::Divide>(f), 0);
+    ASSERT_TRUE(std::any_of(
+        ordered_ops.begin(), ordered_ops.end(), [](const std::shared_ptr<Node>& node) {
+            return is_type<opset3::Relu>(node);
+        }));
+}